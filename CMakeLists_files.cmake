@@ -42,6 +42,7 @@ if(ENABLE_ECL_INPUT)
   list(APPEND MAIN_SOURCE_FILES
     src/opm/json/JsonObject.cpp
     src/opm/parser/eclipse/Deck/Deck.cpp
+    src/opm/parser/eclipse/Deck/DeckCache.cpp
     src/opm/parser/eclipse/Deck/DeckItem.cpp
     src/opm/parser/eclipse/Deck/DeckValue.cpp
     src/opm/parser/eclipse/Deck/DeckKeyword.cpp
@@ -669,6 +670,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp
        opm/parser/eclipse/Deck/DeckItem.hpp
        opm/parser/eclipse/Deck/Deck.hpp
+       opm/parser/eclipse/Deck/DeckCache.hpp
        opm/parser/eclipse/Deck/DeckSection.hpp
        opm/parser/eclipse/Deck/DeckOutput.hpp
        opm/parser/eclipse/Deck/DeckValue.hpp
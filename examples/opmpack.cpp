@@ -26,14 +26,20 @@
 #include <opm/parser/eclipse/Parser/ParseContext.hpp>
 #include <opm/parser/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
 
 
-inline void pack_deck( const char * deck_file, std::ostream& os) {
+inline void pack_deck( const char * deck_file, const char * cache_file, std::ostream& os) {
     Opm::ParseContext parseContext(Opm::InputError::WARN);
     Opm::ErrorGuard errors;
     Opm::Parser parser;
 
-    auto deck = parser.parseFile(deck_file, parseContext, errors);
+    Opm::Deck deck;
+    if (!cache_file || !Opm::DeckCache::load(cache_file, deck)) {
+        deck = parser.parseFile(deck_file, parseContext, errors);
+        if (cache_file)
+            Opm::DeckCache::save(deck, cache_file);
+    }
     os << deck;
 
 }
@@ -63,6 +69,13 @@ Print NEW_CASE in cwd:
     opmpack -o NEW_CASE.DATA path/to/MY_CASE.DATA
 
 
+With the option -c the parsed deck is stored in a cache file, and
+reused on the next invocation as long as none of the input files
+have changed:
+
+    opmpack -c /tmp/MY_CASE.CACHE path/to/MY_CASE.DATA
+
+
 )";
     std::cerr << help_text << std::endl;
     exit(1);
@@ -73,10 +86,11 @@ int main(int argc, char** argv) {
     int arg_offset = 1;
     bool stdout_output = true;
     const char * coutput_arg;
+    const char * cache_arg = nullptr;
 
     while (true) {
         int c;
-        c = getopt(argc, argv, "o:");
+        c = getopt(argc, argv, "o:c:");
         if (c == -1)
             break;
 
@@ -85,6 +99,9 @@ int main(int argc, char** argv) {
             stdout_output = false;
             coutput_arg = optarg;
             break;
+        case 'c':
+            cache_arg = optarg;
+            break;
         }
     }
     arg_offset = optind;
@@ -92,7 +109,7 @@ int main(int argc, char** argv) {
         print_help_and_exit();
 
     if (stdout_output)
-        pack_deck(argv[arg_offset], std::cout);
+        pack_deck(argv[arg_offset], cache_arg, std::cout);
     else {
         std::ofstream os;
         using path = boost::filesystem::path;
@@ -104,7 +121,7 @@ int main(int argc, char** argv) {
         } else
             os.open(output_arg.string());
 
-        pack_deck(argv[arg_offset], os);
+        pack_deck(argv[arg_offset], cache_arg, os);
     }
 }
 
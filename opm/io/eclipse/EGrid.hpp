@@ -34,7 +34,7 @@ namespace Opm { namespace EclIO {
 class EGrid : public EclFile
 {
 public:
-    explicit EGrid(const std::string& filename);
+    explicit EGrid(const std::string& filename, bool memoryMap = false);
 
     int global_index(int i, int j, int k) const;
     int active_index(int i, int j, int k) const;
@@ -36,7 +36,7 @@ namespace Opm { namespace EclIO {
 class ERst : public EclFile
 {
 public:
-    explicit ERst(const std::string& filename);
+    explicit ERst(const std::string& filename, bool memoryMap = false);
     bool hasReportStepNumber(int number) const;
 
     void loadReportStepNumber(int number);
@@ -19,10 +19,15 @@
 #ifndef OPM_IO_ESMRY_HPP
 #define OPM_IO_ESMRY_HPP
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <boost/filesystem.hpp> 
 
+#include <opm/io/eclipse/EclFile.hpp>
+
 namespace Opm { namespace EclIO {
 
 class ESmry
@@ -30,6 +35,10 @@ class ESmry
 public:
 
     // input is smspec (or fsmspec file)     
+    // Only an index of the time steps is built on construction, summary
+    // vectors are read from the result files when first requested.  The
+    // const accessors may be called concurrently; loading is serialized
+    // internally.
     explicit ESmry(const std::string& filename, bool loadBaseRunData=false);
     
     int numberOfVectors() const { return nVect; }
@@ -38,6 +47,12 @@ public:
 
     const std::vector<float>& get(const std::string& name) const;
 
+    // Reads all requested vectors in one pass over the result files
+    std::vector<std::vector<float>> get(const std::vector<std::string>& names) const;
+
+    void loadData() const;                                     // load all vectors
+    void loadData(const std::vector<std::string>& names) const;  // load vectors in one pass
+
     std::vector<float> get_at_rstep(const std::string& name) const;
 
     const std::vector<std::string>& keywordList() const { return keyword; }
@@ -48,8 +63,44 @@ private:
     int nVect, nI, nJ, nK;
 
     void ijk_from_global_index(int glob, int &i, int &j, int &k) const;
-    std::vector<std::vector<float>> param;
+    mutable std::vector<std::vector<float>> param;
+    mutable std::vector<bool> vectorLoaded;
+    // Guards param, vectorLoaded and resultFiles; held through a pointer
+    // so that ESmry remains movable.
+    std::unique_ptr<std::mutex> loadMutex { new std::mutex };
     std::vector<std::string> keyword;
+    std::unordered_map<std::string, int> keywordIndex;
+
+    // Result files (UNSMRY or Snnnn) of all runs, kept open for reading
+    // vectors on demand.
+    std::vector<std::unique_ptr<EclFile>> resultFiles;
+
+    // Location of the summary data of one time step.  Parameter at
+    // position p in the SMSPEC file is element p*stride + offset of array
+    // 'array' in result file 'file'.  PARAMS arrays have stride 1 and
+    // offset 0, column-major (UCSMRY) blocks have stride equal to the
+    // number of time steps in the block.
+    struct TimeStepPosition
+    {
+        int file;
+        int array;
+        int run;        // 0 = this run, 1 = base run, ...
+        int stride;
+        int offset;
+    };
+
+    std::vector<TimeStepPosition> timeStepList;
+
+    // arrayPos[run][ind] is position of vector ind in PARAMS arrays of
+    // that run, -1 if not present.
+    std::vector<std::vector<int>> arrayPos;
+
+    int getKeywordIndex(const std::string& name) const;
+    void loadVectors(const std::vector<int>& indices) const;
+
+    bool indexColumnFile(const std::string& fileName, const std::vector<std::string>& resultsFileList,
+                         int run, int nParams, int& reportStepNumber, int toReportStepNumber,
+                         std::vector<bool>& seqhdrAfter);
 
     std::vector<int> seqIndex;
     std::vector<float> seqTime;
@@ -23,7 +23,9 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <ios>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -35,8 +37,13 @@ namespace Opm { namespace EclIO {
 class EclFile
 {
 public:
-    explicit EclFile(const std::string& filename, bool preload = false);
+    // If memoryMap is true, binary files are mapped into memory and
+    // arrays are decoded directly from the mapped pages rather than
+    // through std::fstream.  Ignored for formatted files, and on
+    // platforms without mmap() support.
+    explicit EclFile(const std::string& filename, bool preload = false, bool memoryMap = false);
     bool formattedInput() { return formatted; }
+    bool memoryMapped() const { return static_cast<bool>(mappedData); }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -61,6 +68,17 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // Extract selected elements of a numeric (INTE, REAL or DOUB) array
+    // without loading the complete array.  Elements are read directly
+    // from the file for binary input.
+    template <typename T>
+    std::vector<T> getElements(int arrIndex, const std::vector<int>& elements);
+
+    // Extract the contiguous elements first ... first+count-1 of a numeric
+    // array, with one read per Fortran record for binary input.
+    template <typename T>
+    std::vector<T> getElementRange(int arrIndex, int first, int count);
+
     bool hasKey(const std::string &name) const;
 
     const std::vector<std::string>& arrayNames() const { return array_name; }
@@ -101,13 +119,34 @@ protected:
         return array.at(arrIndex);
     }
 
+    template<class T>
+    std::vector<T> getElementsImpl(int arrIndex, eclArrType type,
+                                   const std::unordered_map<int, std::vector<T>>& array,
+                                   const std::string& typeStr,
+                                   const std::vector<int>& elements);
+
+    template<class T>
+    std::vector<T> getElementRangeImpl(int arrIndex, eclArrType type,
+                                       const std::unordered_map<int, std::vector<T>>& array,
+                                       const std::string& typeStr,
+                                       int first, int count);
+
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
 private:
     std::vector<bool> arrayLoaded;
 
+    // Read-only mapping of the complete file, shared between copies.
+    std::shared_ptr<const char> mappedData;
+    std::size_t mappedSize = 0;
+
+    void mapFile();
+    void scanMappedHeaders();
+
+    void loadBinaryArrays(const std::vector<int>& arrIndex);
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadBinaryArray(const char* data, std::size_t dataSize, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, long int fromPos);
     
 };
@@ -18,6 +18,8 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
 #include <ios>
 #include <string>
@@ -71,6 +73,53 @@ public:
         }
     }
 
+    // Write an array of 'size' elements of type T, where element i is
+    // computed on the fly as value(i). The elements are generated and
+    // written one record block at a time, so converted copies of large
+    // arrays, e.g. COORD and ZCORN in output units, are never
+    // materialized in full. The output is identical to write() with
+    // the corresponding vector.
+    template<typename T, typename Generator>
+    void write(const std::string& name,
+               const std::size_t size,
+               Generator&& value)
+    {
+        eclArrType arrType = MESS;
+        if (typeid(T) == typeid(int))
+            arrType = INTE;
+        else if (typeid(T) == typeid(float))
+            arrType = REAL;
+        else if (typeid(T) == typeid(double))
+            arrType = DOUB;
+        else if (typeid(T) == typeid(bool))
+            arrType = LOGI;
+
+        if (isFormatted)
+            writeFormattedHeader(name, size, arrType);
+        else
+            writeBinaryHeader(name, size, arrType);
+
+        if (arrType == MESS)
+            return;
+
+        const std::size_t chunkSize = blockElements(arrType);
+        std::vector<T> chunk;
+        chunk.reserve(std::min(chunkSize, size));
+
+        for (std::size_t first = 0; first < size; first += chunkSize) {
+            const std::size_t last = std::min(size, first + chunkSize);
+
+            chunk.clear();
+            for (std::size_t i = first; i < last; i++)
+                chunk.push_back(value(i));
+
+            if (isFormatted)
+                writeFormattedArray(chunk);
+            else
+                writeBinaryArray(chunk);
+        }
+    }
+
     void message(const std::string& msg);
     void flushStream();
 
@@ -94,6 +143,10 @@ private:
     void writeFormattedCharArray(const std::vector<std::string>& data);
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
+    // Number of elements in one record block (binary) or one line
+    // block (formatted) for the given array type.
+    std::size_t blockElements(eclArrType arrType) const;
+
     std::string make_real_string(float value) const;
     std::string make_doub_string(double value) const;
 
@@ -21,6 +21,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <string>
 #include <tuple>
 
@@ -30,6 +31,12 @@ namespace Opm { namespace EclIO {
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
 
+    // Block versions, converting 'num' consecutive values in place.
+    // Intended for complete Fortran records (up to 1000 elements).
+    void flipEndianInt(int* data, std::size_t num);
+    void flipEndianFloat(float* data, std::size_t num);
+    void flipEndianDouble(double* data, std::size_t num);
+
     std::tuple<int, int> block_size_data_binary(eclArrType arrType);
     std::tuple<int, int, int> block_size_data_formatted(eclArrType arrType);
 
@@ -24,6 +24,8 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <functional>
 #include <ios>
 #include <memory>
 #include <string>
@@ -106,6 +108,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write single precision floating point data to underlying
+        /// output stream without creating a full copy of the array.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of elements in output vector.
+        ///
+        /// \param[in] value Function computing element \c i of the
+        ///    output vector.  Called once for each element, in order.
+        void write(const std::string&                        kw,
+                   const std::size_t                         size,
+                   const std::function<float(std::size_t)>& value);
+
     private:
         /// Init file output stream.
         std::unique_ptr<EclOutput> stream_;
@@ -428,6 +443,82 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         EclOutput& stream();
     };
 
+    /// File manager for column-major (transposed) summary output.
+    ///
+    /// Complements the row-major MINISTEP/PARAMS records of the regular
+    /// summary files.  Each block of the file holds the ministeps of one
+    /// report step as the arrays
+    ///
+    ///   SEQHDR   -- Report step (INTE, 1 element)
+    ///   MINISTEP -- Ministep IDs in block (INTE, nstep elements)
+    ///   COLUMNS  -- Parameter values (REAL, nparam * nstep elements)
+    ///
+    /// with all values of parameter 'p' stored contiguously in elements
+    /// p*nstep ... (p+1)*nstep - 1 of COLUMNS.  Parameters are ordered as
+    /// in the summary specification (SMSPEC) file.
+    ///
+    /// A vector is contiguous within each block only, so reading a single
+    /// vector takes one read per report step rather than one read for the
+    /// whole file.  Blocks are appended as the simulation proceeds, so the
+    /// file is usable while the run is still in progress.
+    class SummaryColumns
+    {
+    public:
+        /// Constructor.
+        ///
+        /// Opens file stream for writing.
+        ///
+        /// \param[in] rset Output directory and base name of output stream.
+        ///
+        /// \param[in] fmt Whether or not to create formatted output files.
+        ///
+        /// \param[in] numParams Number of summary parameters per ministep.
+        explicit SummaryColumns(const ResultSet& rset,
+                                const Formatted& fmt,
+                                const int        numParams);
+
+        ~SummaryColumns();
+
+        SummaryColumns(const SummaryColumns& rhs) = delete;
+        SummaryColumns(SummaryColumns&& rhs);
+
+        SummaryColumns& operator=(const SummaryColumns& rhs) = delete;
+        SummaryColumns& operator=(SummaryColumns&& rhs);
+
+        /// Buffer parameter values of a single ministep.
+        ///
+        /// Buffered ministeps of a previous report step are written to
+        /// the output stream as a separate block.
+        ///
+        /// \param[in] seqnum Report step of ministep.
+        ///
+        /// \param[in] ministep Ministep ID.
+        ///
+        /// \param[in] params Parameter values, in SMSPEC order.
+        void add(const int                 seqnum,
+                 const int                 ministep,
+                 const std::vector<float>& params);
+
+        /// Write all buffered ministeps to the output stream, and flush
+        /// the stream.
+        void write();
+
+    private:
+        int numParams_;
+        int seqnum_{-1};
+        std::vector<int> ministeps_{};
+
+        /// Buffered values, row-major (one row per ministep).
+        std::vector<float> rows_{};
+
+        /// Column-major summary output stream.
+        std::unique_ptr<EclOutput> stream_;
+
+        void writeBlock();
+
+        EclOutput& stream();
+    };
+
     std::unique_ptr<EclOutput>
     createSummaryFile(const ResultSet& rset,
                       const int        seqnum,
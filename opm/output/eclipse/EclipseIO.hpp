@@ -22,6 +22,7 @@
 #ifndef OPM_ECLIPSE_WRITER_HPP
 #define OPM_ECLIPSE_WRITER_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -223,6 +224,24 @@ public:
     RestartValue loadRestart(SummaryState& summary_state, const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys = {}) const;
     const out::Summary& summary();
 
+    /*
+      Asynchronous output. After enableAsyncOutput() has been called the
+      writeTimeStep() method will only record the summary values and take a
+      snapshot of the SummaryState; the summary, restart and RFT files are
+      then written on a dedicated output thread while the caller continues
+      with the next timestep. At most max_pending timesteps can be queued,
+      writeTimeStep() will block while the queue is full.
+
+      The EclipseState, grid and Schedule are read from the output thread,
+      so the caller must call flushOutput() before modifying the Schedule,
+      e.g. when applying ACTIONX results. The flushOutput() method blocks
+      until all queued output has been written, and rethrows the first
+      exception raised while writing. The destructor will implicitly wait
+      for pending output, and log an error raised while writing it.
+    */
+    void enableAsyncOutput(std::size_t max_pending = 2);
+    void flushOutput();
+
     EclipseIO( const EclipseIO& ) = delete;
     ~EclipseIO();
 
@@ -68,6 +68,10 @@ public:
 
     void write() const;
 
+    // Number of threads used to run the summary evaluators in eval().
+    // Only effective when built with OpenMP support.  Default 1.
+    void set_eval_threads(const int num_threads);
+
 private:
     class SummaryImplementation;
     std::unique_ptr<SummaryImplementation> pImpl_;
@@ -152,6 +152,14 @@ namespace Opm {
             void setDataFile(const std::string& dataFile);
             std::string makeDeckPath(const std::string& path) const;
 
+            /*
+              The canonical names of all the files opened by the parser, in
+              the order they were opened; a file which is included several
+              times is listed once for every inclusion.
+            */
+            const std::vector<std::string>& getInputFiles() const;
+            void addInputFile(const std::string& filename);
+
             iterator begin();
             iterator end();
             void write( DeckOutput& output ) const ;
@@ -169,6 +177,7 @@ namespace Opm {
 
             std::string m_dataFile;
             std::string input_path;
+            std::vector<std::string> input_files;
             mutable std::size_t unit_system_access_count = 0;
     };
 }
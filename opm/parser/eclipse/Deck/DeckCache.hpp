@@ -0,0 +1,60 @@
+/*
+  Copyright 2020 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DECK_CACHE_HPP
+#define DECK_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace Opm {
+
+    class Deck;
+
+    /*
+      Binary snapshot of a parsed Deck. The snapshot stores the keywords
+      with their items in internal representation, together with the
+      names and content hashes of all the input files opened when the
+      deck was parsed. When loading, the snapshot is only accepted if it was
+      written with the current format version and all the input files
+      still have the same content; otherwise load() returns false and
+      the deck must be parsed again:
+
+          Deck deck;
+          if (!DeckCache::load(cache_file, deck)) {
+              deck = parser.parseFile(data_file, parseContext, errors);
+              DeckCache::save(deck, cache_file);
+          }
+
+      The snapshot does not know which ParseContext or parser keywords
+      were used; a cache file should only be reused with the same parser
+      configuration. All the files opened by the parser are part of the
+      content check, also include files which do not contribute any
+      keywords.
+    */
+    namespace DeckCache {
+
+        const std::uint32_t format_version = 3;
+
+        void save(const Deck& deck, const std::string& cache_file);
+        bool load(const std::string& cache_file, Deck& deck);
+
+    }
+}
+#endif
@@ -54,6 +54,16 @@ namespace Opm {
                  bool rawdata,
                  const std::vector<Dimension>& activeDim,
                  const std::vector<Dimension>& defDim);
+        DeckItem(const std::vector<double>& dVec,
+                 const std::vector<int>& iVec,
+                 const std::vector<std::string>& sVec,
+                 const std::vector<UDAValue>& uVec,
+                 type_tag type,
+                 const std::string& itemName,
+                 const std::vector<value::status_run>& valueStatRuns,
+                 bool rawdata,
+                 const std::vector<Dimension>& activeDim,
+                 const std::vector<Dimension>& defDim);
 
         const std::string& name() const;
 
@@ -82,7 +92,8 @@ namespace Opm {
 
         template< typename T > const std::vector< T >& getData() const;
         const std::vector< double >& getSIDoubleData() const;
-        const std::vector<value::status>& getValueStatus() const;
+        std::vector<value::status> getValueStatus() const;
+        const std::vector<value::status_run>& getValueStatusRuns() const;
 
         void push_back( UDAValue );
         void push_back( int );
@@ -132,7 +143,7 @@ namespace Opm {
         const std::vector<std::string>& sVal() const;
         const std::vector<UDAValue>& uVal() const;
 
-        const std::vector<value::status>& valueStatus() const;
+        std::vector<value::status> valueStatus() const;
         bool rawData() const;
         const std::vector<Dimension>& activeDimensions() const;
         const std::vector<Dimension>& defaultDimensions() const;
@@ -146,7 +157,13 @@ namespace Opm {
         type_tag type = type_tag::unknown;
 
         std::string item_name;
-        std::vector<value::status> value_status;
+
+        /*
+          The status of the values is run length encoded. For the large
+          data keywords like ZCORN there are only a handful of runs, instead
+          of one status byte per value.
+        */
+        std::vector<value::status_run> value_status;
         /*
           To save space we mutate the dval object in place when asking for SI
           data; the current state of of the dval member is tracked with the
@@ -156,6 +173,8 @@ namespace Opm {
         std::vector< Dimension > active_dimensions;
         std::vector< Dimension > default_dimensions;
 
+        value::status status( size_t index ) const;
+        void push_status( value::status st, size_t n = 1 );
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
         template< typename T > void push( T );
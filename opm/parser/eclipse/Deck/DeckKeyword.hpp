@@ -75,7 +75,8 @@ namespace Opm {
         const std::vector<double>& getRawDoubleData() const;
         const std::vector<double>& getSIDoubleData() const;
         const std::vector<std::string>& getStringData() const;
-        const std::vector<value::status>& getValueStatus() const;
+        std::vector<value::status> getValueStatus() const;
+        const std::vector<value::status_run>& getValueStatusRuns() const;
         size_t getDataSize() const;
         void write( DeckOutput& output ) const;
         void write_data( DeckOutput& output ) const;
@@ -20,6 +20,8 @@
 #ifndef VALUE_STATUS
 #define VALUE_STATUS
 
+#include <cstddef>
+
 namespace Opm {
 
 namespace value {
@@ -50,6 +52,17 @@ inline bool has_value(status st) {
 
     return false;
 }
+
+
+/*
+  A run of consecutive values with the same status; end is the index one
+  past the last value of the run.
+*/
+struct status_run {
+    status value_status;
+    std::size_t end;
+};
+
 }
 }
 
@@ -26,6 +26,7 @@
 #include <opm/parser/eclipse/Deck/DeckItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
@@ -58,6 +59,19 @@ namespace Opm {
                              const TableManager& tableManager,
                              const EclipseGrid& eclipseGrid);
 
+        /*
+          Placeholder used by EclipseState when built with
+          ENABLE_FIELDPROPS_ONLY, where the deck is only processed by the
+          FieldPropsManager. getRegions(), getDefaultRegionKeyword(),
+          hasDeckIntGridProperty(), hasDeckDoubleGridProperty() and
+          supportsGridProperty() are answered by the FieldPropsManager,
+          getIntProperties() and getDoubleProperties() return empty
+          containers, and getIntGridProperty() and getDoubleGridProperty()
+          throw std::logic_error.
+        */
+        struct FieldPropsOnly {};
+        Eclipse3DProperties(FieldPropsOnly, const FieldPropsManager& fieldProps);
+
         std::vector< int > getRegions( const std::string& keyword ) const;
         std::string getDefaultRegionKeyword() const;
 
@@ -72,6 +86,7 @@ namespace Opm {
         bool supportsGridProperty(const std::string& keyword) const;
 
     private:
+        void assertDeckProperties(const std::string& method) const;
         const GridProperty<int>& getRegion(const DeckItem& regionItem) const;
         void processGridProperties(const Deck& deck,
                                    const EclipseGrid& eclipseGrid);
@@ -106,6 +121,8 @@ namespace Opm {
         UnitSystem             m_deckUnitSystem;
         GridProperties<int>    m_intGridProperties;
         GridProperties<double> m_doubleGridProperties;
+        bool                   m_fieldPropsOnly = false;
+        FieldPropsManager      m_fieldProps;
     };
 }
 
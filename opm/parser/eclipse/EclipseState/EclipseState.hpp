@@ -98,6 +98,13 @@ namespace Opm {
         bool hasInputEDITNNC() const;
 
         const FieldPropsManager& fieldProps() const;
+
+        /*
+          When built with ENABLE_FIELDPROPS_ONLY the deck is only processed
+          by the FieldPropsManager; the Eclipse3DProperties instance returned
+          here answers the region and keyword queries from fieldProps(), but
+          has no GridProperty objects to hand out.
+        */
         const Eclipse3DProperties& get3DProperties() const;
         const TableManager& getTableManager() const;
         const EclipseConfig& getEclipseConfig() const;
@@ -132,8 +139,8 @@ namespace Opm {
         NNC m_inputNnc;
         EDITNNC m_inputEditNnc;
         EclipseGrid m_inputGrid;
-        Eclipse3DProperties m_eclipseProperties;
         FieldPropsManager field_props;
+        Eclipse3DProperties m_eclipseProperties;
         const SimulationConfig m_simulationConfig;
         TransMult m_transMult;
 
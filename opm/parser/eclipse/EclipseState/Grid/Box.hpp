@@ -44,6 +44,27 @@ namespace Opm {
 
         };
 
+        /*
+          A run of active cells which are consecutive along the I
+          direction; the global, active and data index all increase by
+          one for each cell in the run. Iterating over the runs is
+          equivalent to iterating over index_list(), but the runs are
+          much more compact for large boxes.
+        */
+        struct index_run {
+            std::size_t global_index;
+            std::size_t active_index;
+            std::size_t data_index;
+            std::size_t length;
+
+            index_run(std::size_t g, std::size_t a, std::size_t d, std::size_t l) :
+                global_index(g),
+                active_index(a),
+                data_index(d),
+                length(l)
+            {}
+        };
+
         Box(const EclipseGrid& grid);
         Box(const EclipseGrid& grid , int i1 , int i2 , int j1 , int j2 , int k1 , int k2);
         void update(const DeckRecord& deckRecord);
@@ -52,7 +73,14 @@ namespace Opm {
         size_t size() const;
         bool   isGlobal() const;
         size_t getDim(size_t idim) const;
+        /*
+          The per cell lists returned by index_list() and getIndexList()
+          are built on the first call. These two accessors are therefore
+          not thread safe; concurrent code should use index_runs(), which
+          is built eagerly.
+        */
         const std::vector<cell_index>& index_list() const;
+        const std::vector<index_run>& index_runs() const;
         const std::vector<size_t>& getIndexList() const;
         bool equal(const Box& other) const;
 
@@ -67,14 +95,19 @@ namespace Opm {
     private:
         void init(int i1, int i2, int j1, int j2, int k1, int k2);
         void initIndexList();
+        void initCellLists() const;
         const EclipseGrid& grid;
         size_t m_stride[3];
         size_t m_dims[3] = { 0, 0, 0 };
         size_t m_offset[3];
 
         bool   m_isGlobal;
-        std::vector<size_t> global_index_list;
-        std::vector<cell_index> m_index_list;
+        std::vector<index_run> m_index_runs;
+
+        // The per cell lists are only materialized on request.
+        mutable bool m_cell_lists = false;
+        mutable std::vector<size_t> global_index_list;
+        mutable std::vector<cell_index> m_index_list;
 
         int lower(int dim) const;
         int upper(int dim) const;
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Opm {
@@ -212,6 +213,45 @@ namespace Opm {
         std::vector<int> m_active_to_global;
         std::vector<int> m_global_to_active;
 
+        // Lazily calculated geometry of the active cells, indexed by
+        // active index. Each quantity is calculated for all active cells
+        // the first time it is requested, and is thereafter read without
+        // locking. The cache is dropped when ZCORN or ACTNUM changes, and
+        // a copied grid starts out with an empty cache of its own.
+        class CellGeometryCache {
+        public:
+            struct Data {
+                std::once_flag volume_once;
+                std::once_flag depth_once;
+                std::once_flag center_once;
+                std::once_flag dims_once;
+
+                std::vector<double> volume;
+                std::vector<double> depth;
+                std::vector<std::array<double, 3>> center;
+                std::vector<std::array<double, 3>> dims;
+            };
+
+            CellGeometryCache() : data(new Data) {}
+            CellGeometryCache(const CellGeometryCache&) : data(new Data) {}
+            CellGeometryCache& operator=(const CellGeometryCache&) { this->reset(); return *this; }
+
+            Data& operator*() const { return *this->data; }
+            void reset() { this->data.reset(new Data); }
+
+        private:
+            std::unique_ptr<Data> data;
+        };
+        CellGeometryCache m_cell_geometry;
+
+        const std::vector<double>& activeCellVolumes() const;
+        const std::vector<double>& activeCellDepths() const;
+        const std::vector<std::array<double, 3>>& activeCellCenters() const;
+        const std::vector<std::array<double, 3>>& activeCellDims() const;
+
+        template <typename T, typename Calculate>
+        std::vector<T> calculateActiveCells(Calculate&& calculate) const;
+
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile, std::string fileName);
 
         void initBinaryGrid(const Deck& deck);
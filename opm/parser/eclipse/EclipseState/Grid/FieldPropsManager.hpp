@@ -213,6 +213,15 @@ public:
     template <typename T>
     std::vector<std::string> keys() const;
 
+    /*
+      Number of threads used to process the data keywords and the keyword
+      operations when a FieldPropsManager is constructed. The setting is
+      process wide and must be made before the EclipseState is created.
+      Only effective when built with OpenMP support. Default 1.
+    */
+    static void set_threads(int num_threads);
+    static int threads();
+
 private:
     std::shared_ptr<FieldProps> fp;
 };
@@ -21,6 +21,11 @@
 #ifndef OPM_PARSER_MULTREGTSCANNER_HPP
 #define OPM_PARSER_MULTREGTSCANNER_HPP
 
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
 #include <opm/parser/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
@@ -74,15 +79,41 @@ namespace Opm {
                         const std::vector< const DeckKeyword* >& keywords);
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
 
+        /*
+          Multipliers for all the faces of the grid, evaluated in one
+          pass. Element g of the returned vectors 0, 1 and 2 is the
+          multiplier for the face between cell g and its neighbour in
+          the I+, J+ and K+ direction respectively; i.e. the value of
+          getRegionMultiplier(g, g + stride, XPlus/YPlus/ZPlus). Faces
+          on the boundary of the grid get the value 1.
+        */
+        std::array<std::vector<double>, 3> getFaceMultipliers() const;
+
     private:
+        /*
+          Dense lookup table for the records of one region array. The
+          region values appearing in the records are mapped to compact
+          slots, and the table holds the index in m_records of the
+          record for each (slot1, slot2) pair, or -1.
+        */
+        struct RegionLookup {
+            std::string region_name;
+            std::vector<int> region_data;
+            std::vector<int> slot;
+            std::size_t num_slots = 0;
+            std::vector<int> table;
+
+            int record(int region1, int region2) const;
+        };
+
         void addKeyword( const DeckKeyword& deckKeyword, const std::string& defaultRegion);
         void assertKeywordSupported(const DeckKeyword& deckKeyword);
+        double multiplier(std::size_t globalIndex1, std::size_t globalIndex2, FaceDir::DirEnum faceDir) const;
         std::size_t nx,ny,nz;
         const FieldPropsManager& fp;
         const Eclipse3DProperties& m_e3DProps;
         std::vector< MULTREGTRecord > m_records;
-        std::map<std::string , MULTREGTSearchMap> m_searchMap;
-        std::map<std::string, std::vector<int>> regions;
+        std::vector< RegionLookup > m_lookup;
         std::string default_region;
     };
 
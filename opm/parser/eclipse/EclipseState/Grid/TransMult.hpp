@@ -30,9 +30,11 @@
 #define OPM_PARSER_TRANSMULT_HPP
 
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -52,6 +54,13 @@ namespace Opm {
         double getMultiplier(size_t globalIndex, FaceDir::DirEnum faceDir) const;
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
+
+        /*
+          MULTREGT multipliers of all the I+, J+ and K+ faces of the grid,
+          evaluated in one pass; see MULTREGTScanner::getFaceMultipliers().
+        */
+        std::array<std::vector<double>, 3> getRegionFaceMultipliers() const;
+
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
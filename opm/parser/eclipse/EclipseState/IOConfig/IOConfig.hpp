@@ -160,7 +160,8 @@ namespace Opm {
                  const std::string& output_dir,
                  bool no_sim,
                  const std::string& base_name,
-                 bool ecl_compatible_rst);
+                 bool ecl_compatible_rst,
+                 bool columnar_summary);
 
         void setEclCompatibleRST(bool ecl_rst);
         bool getEclCompatibleRST() const;
@@ -170,6 +171,11 @@ namespace Opm {
         bool getUNIFIN() const;
         bool getFMTIN() const;
         bool getFMTOUT() const;
+
+        /// Whether to write a column-major summary file (.UCSMRY)
+        /// alongside the regular summary output.
+        bool getColumnarSummary() const;
+        void setColumnarSummary(bool columnar);
         const std::string& getDeckFileName() const;
         bool getNoSim() const;
         const std::string& getEclipseInputPath() const;
@@ -216,6 +222,7 @@ namespace Opm {
         bool            m_nosim;
         std::string     m_base_name;
         bool            ecl_compatible_rst = true;
+        bool            m_columnar_summary = false;
 
         IOConfig( const GRIDSection&,
                   const RUNSPECSection&,
@@ -50,6 +50,12 @@ namespace Opm {
        The update() method returns true if the updated value is
        different from the current value, this implies that the
        class<T> must support operator!=
+
+       Internally only the report steps where the value changes are
+       stored, together with the new value; a value is looked up with a
+       binary search among the change points. Iterating with begin() and
+       end() visits the stored values, i.e. one element for each
+       interval of report steps with the same value.
     */
 
 
@@ -63,25 +69,41 @@ class DynamicState {
         DynamicState() = default;
 
         DynamicState( const TimeMap& timeMap, T initial ) :
-            m_data( timeMap.size(), initial ),
+            m_steps( 1, 0 ),
+            m_values( 1, initial ),
+            m_size( timeMap.size() ),
             initial_range( timeMap.size() )
         {}
 
         DynamicState(const std::vector<T>& data,
                      size_t init_range) :
-            m_data(data), initial_range(init_range)
-        {}
+            m_size(data.size()), initial_range(init_range)
+        {
+            for (size_t index = 0; index < data.size(); index++) {
+                if (index == 0 || data[index] != this->m_values.back()) {
+                    this->m_steps.push_back( index );
+                    this->m_values.push_back( data[index] );
+                }
+            }
+        }
 
         void globalReset( T value ) {
-            this->m_data.assign( this->m_data.size(), value );
+            if (this->m_size == 0)
+                return;
+
+            this->m_steps.assign( 1, 0 );
+            this->m_values.assign( 1, value );
         }
 
         const T& back() const {
-            return m_data.back();
+            return m_values.back();
         }
 
         const T& at( size_t index ) const {
-            return this->m_data.at( index );
+            if (index >= this->m_size)
+                throw std::out_of_range("Invalid index for DynamicState::at()");
+
+            return this->m_values[ this->run_index( index ) ];
         }
 
         const T& operator[](size_t index) const {
@@ -93,26 +115,16 @@ class DynamicState {
         }
 
         void updateInitial( T initial ) {
-            std::fill_n( this->m_data.begin(), this->initial_range, initial );
+            if (this->initial_range > 0)
+                this->assign( 0, this->initial_range, initial );
         }
 
 
         std::vector<std::pair<std::size_t, T>> unique() const {
-            if (this->m_data.empty())
-                return {};
-
-            const auto * current_value = std::addressof(this->m_data[0]);
-            std::size_t current_index = 0;
-            std::vector<std::pair<std::size_t, T>> result{{current_index, *current_value}};
-            while (true) {
-                if (this->m_data[current_index] != *current_value) {
-                    current_value = std::addressof(this->m_data[current_index]);
-                    result.emplace_back(current_index, *current_value);
-                }
-
-                current_index++;
-                if (current_index == this->m_data.size())
-                    break;
+            std::vector<std::pair<std::size_t, T>> result;
+            for (size_t run = 0; run < this->m_values.size(); run++) {
+                if (result.empty() || this->m_values[run] != result.back().second)
+                    result.emplace_back(this->m_steps[run], this->m_values[run]);
             }
 
             return result;
@@ -124,25 +136,28 @@ class DynamicState {
            return true, otherwise it will return false.
         */
         bool update( size_t index, T value ) {
-            if( this->initial_range == this->m_data.size() )
+            if( this->initial_range == this->m_size )
                 this->initial_range = index;
 
-            const bool change = (value != this->m_data.at( index ));
+            const bool change = (value != this->at( index ));
 
             if( !change ) return false;
 
-            std::fill( this->m_data.begin() + index,
-                       this->m_data.end(),
-                       value );
+            const auto first = std::lower_bound( this->m_steps.begin(), this->m_steps.end(), index );
+            this->m_values.erase( this->m_values.begin() + std::distance( this->m_steps.begin(), first ), this->m_values.end() );
+            this->m_steps.erase( first, this->m_steps.end() );
+
+            this->m_steps.push_back( index );
+            this->m_values.push_back( std::move(value) );
 
             return true;
         }
 
         void update_elm( size_t index, const T& value ) {
-            if (this->m_data.size() <= index)
+            if (this->m_size <= index)
                 throw std::out_of_range("Invalid index for update_elm()");
 
-            this->m_data[index] = value;
+            this->assign( index, index + 1, value );
         }
 
 
@@ -154,68 +169,68 @@ class DynamicState {
       applied for all times in the range [Tx,T2].
     */
     void update_equal(size_t index, const T& value) {
-        if (this->m_data.size() <= index)
+        if (this->m_size <= index)
             throw std::out_of_range("Invalid index for update_equal()");
 
-        const T prev_value = this->m_data[index];
+        const T prev_value = this->at(index);
         if (prev_value == value)
             return;
 
-        while (true) {
-            if (this->m_data[index] != prev_value)
-                break;
+        auto run = this->run_index( index );
+        while (run + 1 < this->m_values.size() && this->m_values[run + 1] == prev_value)
+            run++;
 
-            this->m_data[index] = value;
-
-            index++;
-            if (index == this->m_data.size())
-                break;
-
-        }
+        this->assign( index, this->run_end( run ), value );
     }
 
     /// Will return the index of the first occurence of @value, or
     /// -1 if @value is not found.
     int find(const T& value) const {
-        auto iter = std::find( m_data.begin() , m_data.end() , value);
-        if( iter == this->m_data.end() ) return -1;
+        auto iter = std::find( m_values.begin() , m_values.end() , value);
+        if( iter == this->m_values.end() ) return -1;
 
-        return std::distance( m_data.begin() , iter );
+        return this->m_steps[ std::distance( m_values.begin() , iter ) ];
     }
 
     template<typename P>
     int find_if(P&& pred) const {
-        auto iter = std::find_if(m_data.begin(), m_data.end(), std::forward<P>(pred));
-        if( iter == this->m_data.end() ) return -1;
+        auto iter = std::find_if(m_values.begin(), m_values.end(), std::forward<P>(pred));
+        if( iter == this->m_values.end() ) return -1;
 
-        return std::distance( m_data.begin() , iter );
+        return this->m_steps[ std::distance( m_values.begin() , iter ) ];
     }
 
     /// Will return the index of the first value which is != @value, or -1
     /// if all values are == @value
     int find_not(const T& value) const {
-        auto iter = std::find_if_not( m_data.begin() , m_data.end() , [&value] (const T& elm) { return value == elm; });
-        if( iter == this->m_data.end() ) return -1;
+        auto iter = std::find_if_not( m_values.begin() , m_values.end() , [&value] (const T& elm) { return value == elm; });
+        if( iter == this->m_values.end() ) return -1;
 
-        return std::distance( m_data.begin() , iter );
+        return this->m_steps[ std::distance( m_values.begin() , iter ) ];
     }
 
     iterator begin() {
-        return this->m_data.begin();
+        return this->m_values.begin();
     }
 
 
     iterator end() {
-        return this->m_data.end();
+        return this->m_values.end();
     }
 
 
     std::size_t size() const {
-        return this->m_data.size();
+        return this->m_size;
     }
 
-    const std::vector<T>& data() const {
-        return m_data;
+    /// The value for every report step.
+    std::vector<T> data() const {
+        std::vector<T> values;
+        values.reserve( this->m_size );
+        for (size_t run = 0; run < this->m_values.size(); run++)
+            values.insert( values.end(), this->run_end( run ) - this->m_steps[run], this->m_values[run] );
+
+        return values;
     }
 
     size_t initialRange() const {
@@ -223,16 +238,72 @@ class DynamicState {
     }
 
     bool operator==(const DynamicState<T>& data) const {
-        return m_data == data.m_data &&
-               initial_range == data.initial_range;
+        if (this->m_size != data.m_size || this->initial_range != data.initial_range)
+            return false;
+
+        size_t run1 = 0;
+        size_t run2 = 0;
+        size_t step = 0;
+        while (step < this->m_size) {
+            if (!(this->m_values[run1] == data.m_values[run2]))
+                return false;
+
+            const auto end1 = this->run_end( run1 );
+            const auto end2 = data.run_end( run2 );
+            step = std::min( end1, end2 );
+            if (end1 == step)
+                run1++;
+            if (end2 == step)
+                run2++;
+        }
+        return true;
     }
 
     private:
-        std::vector< T > m_data;
-        size_t initial_range;
+        std::vector< size_t > m_steps;
+        std::vector< T > m_values;
+        size_t m_size = 0;
+        size_t initial_range = 0;
+
+        /// The run which holds the value for report step index.
+        size_t run_index( size_t index ) const {
+            const auto iter = std::upper_bound( this->m_steps.begin(), this->m_steps.end(), index );
+            return std::distance( this->m_steps.begin(), iter ) - 1;
+        }
+
+        /// One past the last report step of run.
+        size_t run_end( size_t run ) const {
+            if (run + 1 < this->m_steps.size())
+                return this->m_steps[run + 1];
+
+            return this->m_size;
+        }
+
+        /// Make sure a run starts at report step index.
+        void split( size_t index ) {
+            const auto run = this->run_index( index );
+            if (this->m_steps[run] == index)
+                return;
+
+            T value = this->m_values[run];
+            this->m_steps.insert( this->m_steps.begin() + run + 1, index );
+            this->m_values.insert( this->m_values.begin() + run + 1, std::move(value) );
+        }
+
+        /// Set the value for the report steps [first, last).
+        void assign( size_t first, size_t last, const T& value ) {
+            if (last < this->m_size)
+                this->split( last );
+            this->split( first );
+
+            const auto first_run = this->run_index( first );
+            const auto last_run = (last < this->m_size) ? this->run_index( last ) : this->m_steps.size();
+            this->m_values[first_run] = value;
+            this->m_steps.erase( this->m_steps.begin() + first_run + 1, this->m_steps.begin() + last_run );
+            this->m_values.erase( this->m_values.begin() + first_run + 1, this->m_values.begin() + last_run );
+        }
 };
 
 }
 
 #endif
-
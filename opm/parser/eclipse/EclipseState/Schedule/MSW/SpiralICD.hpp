@@ -22,6 +22,7 @@
 #define SPIRALICD_HPP_HEADER_INCLUDED
 
 #include <map>
+#include <string>
 #include <utility>
 #include <vector>
 
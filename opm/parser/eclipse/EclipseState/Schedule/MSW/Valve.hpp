@@ -21,6 +21,7 @@
 #define VALVE_HPP_HEADER_INCLUDED
 
 #include <map>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -110,6 +110,8 @@ namespace Opm {
     private:
         void processABS();
         void processINC(const bool first_time);
+        void setSegmentIndex(int segment_number, int index);
+        void clearSegmentIndex();
 
         std::string m_well_name;
         // depth of the nodal point of the top segment
@@ -136,6 +138,9 @@ namespace Opm {
         // the mapping from the segment number to the
         // storage index in the vector
         std::map<int, int> segment_number_to_index;
+        // the same mapping as a vector indexed by the segment number,
+        // with -1 for unused segment numbers
+        std::vector<int> segment_lookup;
     };
     std::ostream& operator<<( std::ostream&, const WellSegments& );
 }
@@ -177,6 +177,19 @@ namespace Opm
                  const DynamicState<int>& nupCol,
                  const std::map<std::string,Events>& wellGroupEvents);
 
+        /*
+          Number of threads used to process the keywords of different wells
+          concurrently when a Schedule is constructed. With more than one
+          thread the consecutive COMPDAT keywords of a report step, and the
+          COMPLUMP and WPIMULT keywords following them, are partitioned into
+          one keyword stream per well, and the streams are processed
+          concurrently; the resulting Schedule is identical to the serial
+          one. The setting is process wide, and only effective when built
+          with OpenMP support. Default 1.
+        */
+        static void setThreads(int num_threads);
+        static int threads();
+
         /*
          * If the input deck does not specify a start time, Eclipse's 1. Jan
          * 1983 is defaulted
@@ -210,9 +223,11 @@ namespace Opm
         const Well& getWellatEnd(const std::string& well_name) const;
         std::vector<Well> getWells(size_t timeStep) const;
         std::vector<Well> getWellsatEnd() const;
+        std::vector<const Well*> getWellPtrs(size_t timeStep) const;
 
         std::vector<const Group*> getChildGroups2(const std::string& group_name, size_t timeStep) const;
         std::vector<Well> getChildWells2(const std::string& group_name, size_t timeStep) const;
+        std::vector<const Well*> getChildWellPtrs(const std::string& group_name, size_t timeStep) const;
         const OilVaporizationProperties& getOilVaporizationProperties(size_t timestep) const;
         const Well::ProducerCMode& getGlobalWhistctlMmode(size_t timestep) const;
 
@@ -282,6 +297,8 @@ namespace Opm
     private:
         TimeMap m_timeMap;
         WellMap wells_static;
+        // the well names in sorted order, with the insertion index in wells_static.
+        std::map<std::string, std::size_t> well_name_index;
         GroupMap groups;
         DynamicState< OilVaporizationProperties > m_oilvaporizationproperties;
         Events m_events;
@@ -328,6 +345,7 @@ namespace Opm
         void handleWCONPROD( const DeckKeyword& keyword, size_t currentStep, const ParseContext& parseContext, ErrorGuard& errors);
         void handleWGRUPCON( const DeckKeyword& keyword, size_t currentStep);
         void handleCOMPDAT( const DeckKeyword& keyword,  size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties& eclipseProperties, const ParseContext& parseContext, ErrorGuard& errors);
+        void handleWellStreams( const std::vector<const DeckKeyword*>& keywords, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties& eclipseProperties, const ParseContext& parseContext, ErrorGuard& errors);
         void handleCOMPLUMP( const DeckKeyword& keyword,  size_t currentStep );
         void handleWELSEGS( const DeckKeyword& keyword, size_t currentStep);
         void handleCOMPSEGS( const DeckKeyword& keyword, size_t currentStep, const EclipseGrid& grid, const ParseContext& parseContext, ErrorGuard& errors);
@@ -25,7 +25,10 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <cstddef>
 #include <iosfwd>
+#include <iterator>
+#include <utility>
 
 namespace Opm{
 
@@ -64,7 +67,8 @@ namespace Opm{
 
 class SummaryState {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    class const_iterator;
+
     explicit SummaryState(std::chrono::system_clock::time_point sim_start_arg);
 
     /*
@@ -87,6 +91,36 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_group_var(const std::string& group, const std::string& var) const;
 
+    /*
+      All values are stored in a flat array of slots, and the string based
+      methods above are a facade on top of that array. A caller which
+      repeatedly updates the same set of keys - like the summary evaluation -
+      can look up the slot of each key once and thereafter use the slot based
+      methods below which do not involve any string operations:
+
+          auto slot = st.well_slot("OPX", "WWCT");
+          ...
+          st.update_slot(slot, 0.75);
+          st.get_well_var("OPX", "WWCT") => 0.75
+
+      The slot returned from well_slot() and group_slot() is distinct from
+      the slot of the general key, but updating it will update the general
+      key as well - exactly like update_well_var() and update_group_var().
+      Registering a slot does not make the key visible through has(); that
+      happens when the slot is first updated. Slots are assigned densely from
+      zero and remain valid for as long as layout_id() is unchanged. Copies
+      and deserialized objects get a new layout_id().
+    */
+    std::size_t slot(const std::string& key);
+    std::size_t well_slot(const std::string& well, const std::string& var);
+    std::size_t group_slot(const std::string& group, const std::string& var);
+
+    bool has_slot(std::size_t slot) const;
+    double get_slot(std::size_t slot) const;
+    void update_slot(std::size_t slot, double value);
+    std::size_t num_slots() const;
+    std::size_t layout_id() const;
+
     std::vector<std::string> wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     std::vector<std::string> groups() const;
@@ -97,18 +131,88 @@ public:
     const_iterator end() const;
     std::size_t num_wells() const;
     std::size_t size() const;
+
+    /*
+      Iterates over all keys with a value, yielding (key, value) pairs. The
+      pairs are assembled from the slot arrays on dereference, so this is an
+      input iterator; it->first and it->second go through a proxy.
+    */
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<std::string, double>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const std::string&, double>;
+
+        class pointer {
+        public:
+            explicit pointer(reference ref_arg) : ref(ref_arg) {}
+            const reference* operator->() const { return &this->ref; }
+        private:
+            reference ref;
+        };
+
+        const_iterator(const SummaryState& st, std::size_t slot);
+
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        const SummaryState* st;
+        std::size_t slot;
+
+        void skip_undefined();
+    };
+
 private:
+    enum class SlotType : char { Plain, Well, Group };
+
+    struct LayoutId {
+        LayoutId();
+        LayoutId(const LayoutId&);
+        LayoutId& operator=(const LayoutId&);
+        void renew();
+
+        std::size_t value;
+    };
+
     std::chrono::system_clock::time_point sim_start;
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
-
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    LayoutId layout;
+
+    // Flat value storage; the key of slot i is slot_keys[i]. Only the Plain
+    // slots are indexed by key, a Well or Group slot forwards its updates
+    // to the Plain slot slot_general[i].
+    std::unordered_map<std::string, std::size_t> slot_index;
+    std::vector<std::string> slot_keys;
+    std::vector<double> slot_values;
+    std::vector<char> slot_defined;
+    std::vector<char> slot_total;
+    std::vector<SlotType> slot_type;
+    std::vector<std::string> slot_entity;
+    std::vector<std::size_t> slot_general;
+    std::size_t num_defined = 0;
+
+    // The first key is the variable and the second key is the well; the
+    // value is the slot.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> well_values;
     std::unordered_set<std::string> m_wells;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    // The first key is the variable and the second key is the group; the
+    // value is the slot.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> group_values;
     std::unordered_set<std::string> m_groups;
+
+    std::size_t entity_slot(SlotType type, const std::string& entity, const std::string& var);
+    std::size_t new_slot(const std::string& key, SlotType type, const std::string& entity, bool total);
+    std::size_t find_slot(const std::string& key) const;
+    void assign_slot(std::size_t slot, double value);
+    void accumulate_slot(std::size_t slot, double value);
+    void clear();
 };
 
 
@@ -26,6 +26,7 @@
 #include <vector>
 #include <ctime>
 #include <map>
+#include <string>
 
 #include <stddef.h>
 
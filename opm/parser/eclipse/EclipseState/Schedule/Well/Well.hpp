@@ -21,6 +21,8 @@
 #ifndef WELL2_HPP
 #define WELL2_HPP
 
+#include <map>
+#include <memory>
 #include <string>
 
 #include <opm/parser/eclipse/EclipseState/Runspec.hpp>
@@ -516,7 +518,16 @@ public:
     bool handleCOMPLUMP(const DeckRecord& record);
     bool handleWPIMULT(const DeckRecord& record);
 
+    /*
+      The connection set is shared by the Well objects of all the report
+      steps where it is unchanged, so filtering replaces it with a
+      filtered copy instead of modifying it in place. Wells which share
+      a connection set before the filtering will also share the filtered
+      set if they are filtered with the same FilteredConnections map.
+    */
+    using FilteredConnections = std::map<std::shared_ptr<const WellConnections>, std::shared_ptr<const WellConnections>>;
     void filterConnections(const ActiveGridCells& grid);
+    void filterConnections(const ActiveGridCells& grid, FilteredConnections& filtered);
     void switchToInjector();
     void switchToProducer();
     ProductionControls productionControls(const SummaryState& st) const;
@@ -558,7 +569,7 @@ private:
     std::shared_ptr<const WellFoamProperties> foam_properties;
     std::shared_ptr<const WellPolymerProperties> polymer_properties;
     std::shared_ptr<const WellTracerProperties> tracer_properties;
-    std::shared_ptr<WellConnections> connections; // The WellConnections object can not be const because of the filterConnections method - would be beneficial to rewrite to enable const
+    std::shared_ptr<const WellConnections> connections;
     std::shared_ptr<const WellProductionProperties> production;
     std::shared_ptr<const WellInjectionProperties> injection;
     std::shared_ptr<const WellSegments> segments;
@@ -21,6 +21,10 @@
 #ifndef CONNECTIONSET_HPP_
 #define CONNECTIONSET_HPP_
 
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/Connection.hpp>
 
 #include <opm/common/utility/ActiveGridCells.hpp>
@@ -58,6 +62,18 @@ namespace Opm {
                            const bool defaultSatTabId = true);
         void loadCOMPDAT(const DeckRecord& record, const EclipseGrid& grid, const Eclipse3DProperties& eclipseProperties);
         void loadCOMPDAT(const DeckRecord& record, const EclipseGrid& grid, const FieldPropsManager& field_properties);
+        /*
+          Load a COMPDAT record with the cell properties given as arrays
+          over the active cells; used when several records are loaded
+          with the same properties.
+        */
+        void loadCOMPDAT(const DeckRecord& record,
+                         const EclipseGrid& grid,
+                         const std::vector<int>& satnum_data,
+                         const std::vector<double>* permx,
+                         const std::vector<double>* permy,
+                         const std::vector<double>* permz,
+                         const std::vector<double>& ntg);
 
         using const_iterator = std::vector< Connection >::const_iterator;
 
@@ -113,19 +129,20 @@ namespace Opm {
                            const double segDistEnd= 0.0,
                            const bool defaultSatTabId = true);
 
-        void loadCOMPDAT(const DeckRecord& record,
-                         const EclipseGrid& grid,
-                         const std::vector<int>& satnum_data,
-                         const std::vector<double>* permx,
-                         const std::vector<double>* permy,
-                         const std::vector<double>* permz,
-                         const std::vector<double>& ntg);
 
         size_t findClosestConnection(int oi, int oj, double oz, size_t start_pos);
+        void buildIJKIndex();
+
+        struct IJKHash {
+            std::size_t operator()(const std::array<int,3>& ijk) const;
+        };
 
         int headI, headJ;
         size_t num_removed = 0;
         std::vector< Connection > m_connections;
+        // Position in m_connections of the first connection in each cell;
+        // rebuilt when connections are removed or reordered.
+        std::unordered_map<std::array<int,3>, std::size_t, IJKHash> ijk_index;
     };
 }
 
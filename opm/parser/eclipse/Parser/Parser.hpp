@@ -71,6 +71,24 @@ namespace Opm {
 
         Deck parseStream(std::unique_ptr<std::istream>&& inputStream , const ParseContext& parseContext, ErrorGuard& errors) const;
 
+        /// Update a deck which was parsed from file after the files in
+        /// changed_files have been modified. Only the keywords read from the
+        /// changed include files are parsed again and replaced in a copy of
+        /// the deck; if that is not possible the complete deck is parsed
+        /// from the data file.
+        Deck reparseFiles(const Deck& deck,
+                          const std::vector<std::string>& changed_files,
+                          const ParseContext&,
+                          ErrorGuard& errors) const;
+
+        /// Number of threads used to convert data keywords like PORO and
+        /// ZCORN to numerical values. With more than one thread the
+        /// conversion is deferred and done concurrently; the resulting deck
+        /// is identical to the serial one. Only effective when built with
+        /// OpenMP support. Default 1.
+        void setParseThreads(int num_threads);
+        int parseThreads() const;
+
         /// Method to add ParserKeyword instances, these holding type and size information about the keywords and their data.
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword&& parserKeyword);
@@ -146,6 +164,7 @@ namespace Opm {
         std::map< string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+        int parse_threads = 1;
     };
 
 } // namespace Opm
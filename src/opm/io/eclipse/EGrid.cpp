@@ -30,17 +30,15 @@
 
 namespace Opm { namespace EclIO {
 
-EGrid::EGrid(const std::string &filename) : EclFile(filename)
+EGrid::EGrid(const std::string &filename, bool memoryMap) : EclFile(filename, false, memoryMap)
 {
-   EclFile file(filename);
-
    auto gridhead = get<int>("GRIDHEAD");
 
    nijk[0] = gridhead[1];
    nijk[1] = gridhead[2];
    nijk[2] = gridhead[3];
 
-   if (file.hasKey("ACTNUM")) {
+   if (this->hasKey("ACTNUM")) {
        auto actnum = get<int>("ACTNUM");
 
        nactive = 0;
@@ -29,7 +29,7 @@
 
 namespace Opm { namespace EclIO {
 
-ERft::ERft(const std::string &filename) : EclFile(filename)
+ERft::ERft(const std::string &filename, bool memoryMap) : EclFile(filename, false, memoryMap)
 {
     loadData();
     std::vector<int> first;
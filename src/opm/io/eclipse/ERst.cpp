@@ -56,8 +56,8 @@ namespace {
 
 namespace Opm { namespace EclIO {
 
-ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+ERst::ERst(const std::string& filename, bool memoryMap)
+    : EclFile(filename, false, memoryMap)
 {
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
@@ -28,8 +28,11 @@
 #include <unistd.h>
 #include <limits>
 #include <limits.h>
+#include <mutex>
+#include <numeric>
 #include <set>
 #include <stdexcept>
+#include <utility>
 
 #include <iostream>
 #include <boost/filesystem.hpp> 
@@ -161,16 +164,21 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
     }
 
     int nFiles = static_cast<int>(smryArray.size());
-    
-    // arrayInd should hold indices for each vector and runs
-    // n=file number, i = position in param array in file n (one array pr time step), example arrayInd[n][i] = position in keyword list (std::set) 
 
-    std::vector<std::vector<int>> arrayInd;
-    
-    for (int i = 0; i < nFiles; i++){
-        arrayInd.push_back({});
+    nVect = keywList.size();
+
+    for (auto keyw : keywList){
+        keywordIndex[keyw] = static_cast<int>(keyword.size());
+        keyword.push_back(keyw);
     }
-    
+
+    // arrayPos should hold position in the PARAMS arrays for each vector and run,
+    // n=file number, ind = position in keyword list, example arrayPos[n][ind] = position in PARAMS array
+
+    arrayPos.assign(nFiles, std::vector<int>(nVect, -1));
+
+    std::vector<int> nParamsRun(nFiles, 0);
+
     int n = nFiles - 1;
 
 
@@ -191,31 +199,30 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
         std::vector<std::string> wgnames = smspec.get<std::string>("WGNAMES");
         std::vector<int> nums = smspec.get<int>("NUMS");
 
-        std::vector<int> tmpVect(keywords.size(), -1);
-        arrayInd[n]=tmpVect;
-
-        std::set<std::string>::iterator it;
+        nParamsRun[n] = static_cast<int>(keywords.size());
 
         for (size_t i=0; i < keywords.size(); i++) {
             std::string keyw = makeKeyString(keywords[i], wgnames[i], nums[i]);
-            it = std::find(keywList.begin(), keywList.end(), keyw);
+            auto it = keywordIndex.find(keyw);
 
-            if (it != keywList.end()){
-                arrayInd[n][i] = distance(keywList.begin(), it);
+            if (it != keywordIndex.end()){
+                arrayPos[n][it->second] = static_cast<int>(i);
             }
         }
         
         n--;
     }
 
-    // param array used to stor data for the object, defined in the private section of the class 
-    param.assign(keywList.size(), {});
+    // param array used to store data for the object, defined in the private section
+    // of the class. Vectors are loaded on demand.
+    param.assign(nVect, {});
+    vectorLoaded.assign(nVect, false);
     
     int fromReportStepNumber = 0;
     int toReportStepNumber;
 
-    float time = 0.0;
-    int step = 0;
+    // seqhdrAfter[step] is true if time step 'step' is last step in a report step
+    std::vector<bool> seqhdrAfter;
 
     n = nFiles - 1;
 
@@ -267,110 +274,306 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
             resultsFileList=multFileList;
         }
         
-        // make array list with reference to source files (unifed or non unified)
-        
-        std::vector<std::tuple<std::string, std::string, int>> arraySourceList;
+        // use column-major summary file if present and up to date. A vector is
+        // then stored contiguously within each report step
 
-        for (std::string fileName : resultsFileList){
-            EclFile unsmry(fileName);
-                
-            std::vector<EclFile::EclEntry> arrayList = unsmry.getList();
+        boost::filesystem::path columnFile = rootName;
 
-            for (size_t nn = 0; nn < arrayList.size(); nn++){
-                std::tuple<std::string, std::string, int> t1 = std::make_tuple(std::get<0>(arrayList[nn]), fileName, static_cast<int>(nn));
-                arraySourceList.push_back(t1);
-            }
-        }
+        formattedVect[n] ? columnFile += ".FUCSMRY" : columnFile += ".UCSMRY";
 
-        // loop through arrays and extract symmary data from result files, arrays PARAMS
-        //
-        //    2 or 3 arrays pr time step.
-        //       If timestep is a report step:  MINISTEP, PARAMS and SEQHDR
-        //       else : MINISTEP and PARAMS
+        bool use_columns = boost::filesystem::exists(columnFile) &&
+            (boost::filesystem::last_write_time(columnFile) >= boost::filesystem::last_write_time(resultsFileList.back())) &&
+            indexColumnFile(columnFile.string(), resultsFileList, n, nParamsRun[n], reportStepNumber, toReportStepNumber, seqhdrAfter);
 
-        size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
+        if (!use_columns) {
 
-        std::string prevFile;
-        std::unique_ptr<EclFile> pEclFile;
+            // make array list with reference to source files (unifed or non unified)
+        
+            std::vector<std::tuple<std::string, int, int>> arraySourceList;
 
-        while  (i < arraySourceList.size()){
+            for (std::string fileName : resultsFileList){
+                const int fileIndex = static_cast<int>(resultFiles.size());
+                resultFiles.push_back(std::make_unique<EclFile>(fileName, false, true));
+                
+                std::vector<EclFile::EclEntry> arrayList = resultFiles.back()->getList();
 
-            if (std::get<0>(arraySourceList[i]) != "MINISTEP"){
-                std::string message="Reading summary file, expecting keyword MINISTEP, found '" + std::get<0>(arraySourceList[i]) + "'";
-                throw std::invalid_argument(message);
+                for (size_t nn = 0; nn < arrayList.size(); nn++){
+                    arraySourceList.emplace_back(std::get<0>(arrayList[nn]), fileIndex, static_cast<int>(nn));
+                }
             }
 
-            if (std::get<0>(arraySourceList[i+1]) != "PARAMS") {
-                std::string message="Reading summary file, expecting keyword PARAMS, found '" + std::get<0>(arraySourceList[i]) + "'";
-                throw std::invalid_argument(message);
-            }
-            
-            i++;
+            // loop through arrays and build index of PARAMS arrays in result files
+            //
+            //    2 or 3 arrays pr time step.
+            //       If timestep is a report step:  MINISTEP, PARAMS and SEQHDR
+            //       else : MINISTEP and PARAMS
 
-            if (std::get<1>(arraySourceList[i]) != prevFile){
-                pEclFile = std::make_unique<EclFile>(std::get<1>(arraySourceList[i]));
-                pEclFile->loadData();
-                
-                prevFile = std::get<1>(arraySourceList[i]);
-            }    
-            
-            int m = std::get<2>(arraySourceList[i]);
+            size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
+
+            while  (i < arraySourceList.size()){
+
+                if (std::get<0>(arraySourceList[i]) != "MINISTEP"){
+                    std::string message="Reading summary file, expecting keyword MINISTEP, found '" + std::get<0>(arraySourceList[i]) + "'";
+                    throw std::invalid_argument(message);
+                }
+
+                if (std::get<0>(arraySourceList[i+1]) != "PARAMS") {
+                    std::string message="Reading summary file, expecting keyword PARAMS, found '" + std::get<0>(arraySourceList[i]) + "'";
+                    throw std::invalid_argument(message);
+                }
             
-            std::vector<float> tmpData = pEclFile->get<float>(m);
+                i++;
 
-            time = tmpData[0];
+                timeStepList.push_back({std::get<1>(arraySourceList[i]), std::get<2>(arraySourceList[i]), n, 1, 0});
 
-            if (time == 0.0) {
-                seqTime.push_back(time);
-                seqIndex.push_back(step);
-            }
+                i++;
 
-            i++;
+                bool lastInReport = false;
 
-            if (i < arraySourceList.size()){
-                if (std::get<0>(arraySourceList[i]) == "SEQHDR") {
-                    i++;
+                if (i < arraySourceList.size()){
+                    if (std::get<0>(arraySourceList[i]) == "SEQHDR") {
+                        i++;
+                        reportStepNumber++;
+                        lastInReport = true;
+                    }
+                } else {
                     reportStepNumber++;
-                    seqTime.push_back(time);
-                    seqIndex.push_back(step);
+                    lastInReport = true;
+                }
+
+                seqhdrAfter.push_back(lastInReport);
+
+                if (reportStepNumber >= toReportStepNumber) {
+                    i = arraySourceList.size();
                 }
-            } else {
-                reportStepNumber++;
-                seqTime.push_back(time);
-                seqIndex.push_back(step);
             }
-            
-            // adding defaut values (0.0) in case vector not found in this particular summary file
-            
-            for (size_t ii = 0; ii < param.size(); ii++){            
-                param[ii].push_back(0.0);
+        }
+
+        fromReportStepNumber = toReportStepNumber;
+
+        n--;
+    }
+
+    // Time is first summary parameter
+
+    for (size_t step = 0; step < timeStepList.size(); step++) {
+        const auto& ts = timeStepList[step];
+        float time = resultFiles[ts.file]->getElements<float>(ts.array, {ts.offset})[0];
+
+        if (time == 0.0) {
+            seqTime.push_back(time);
+            seqIndex.push_back(step);
+        }
+
+        if (seqhdrAfter[step]) {
+            seqTime.push_back(time);
+            seqIndex.push_back(step);
+        }
+    }
+}
+
+
+bool ESmry::indexColumnFile(const std::string& fileName, const std::vector<std::string>& resultsFileList,
+                            int run, int nParams, int& reportStepNumber, int toReportStepNumber,
+                            std::vector<bool>& seqhdrAfter)
+{
+    // Column file is a sequence of blocks SEQHDR, MINISTEP and COLUMNS, one
+    // or more blocks pr report step. COLUMNS holds nParams * nstep values, with
+    // values of parameter p in elements p*nstep ... (p+1)*nstep - 1
+
+    auto columns = std::make_unique<EclFile>(fileName, false, true);
+
+    std::vector<EclFile::EclEntry> arrayList = columns->getList();
+
+    if ((arrayList.size() == 0) || (arrayList.size() % 3 != 0)) {
+        return false;
+    }
+
+    std::vector<int> blockSeqnum;
+
+    for (size_t i = 0; i < arrayList.size(); i += 3) {
+        if ((std::get<0>(arrayList[i]) != "SEQHDR") ||
+            (std::get<0>(arrayList[i+1]) != "MINISTEP") ||
+            (std::get<0>(arrayList[i+2]) != "COLUMNS")) {
+            return false;
+        }
+
+        if (std::get<2>(arrayList[i+2]) != nParams * std::get<2>(arrayList[i+1])) {
+            return false;
+        }
+
+        blockSeqnum.push_back(columns->get<int>(i)[0]);
+    }
+
+    // The column file is only used if it holds the same report and time
+    // steps (SEQHDR and MINISTEP values) as the result files.
+
+    std::vector<std::pair<int,int>> columnSteps;
+
+    for (size_t b = 0; b < blockSeqnum.size(); b++) {
+        for (int ministep : columns->get<int>(static_cast<int>(3*b + 1))) {
+            columnSteps.emplace_back(blockSeqnum[b], ministep);
+        }
+    }
+
+    std::vector<std::pair<int,int>> resultSteps;
+    int seqnum = -1;
+
+    for (const auto& resultFileName : resultsFileList) {
+        EclFile resultFile(resultFileName, false, true);
+        const auto resultList = resultFile.getList();
+
+        for (size_t i = 0; i < resultList.size(); i++) {
+            if (std::get<0>(resultList[i]) == "SEQHDR") {
+                seqnum = resultFile.get<int>(static_cast<int>(i))[0];
+            } else if (std::get<0>(resultList[i]) == "MINISTEP") {
+                resultSteps.emplace_back(seqnum, resultFile.get<int>(static_cast<int>(i))[0]);
             }
+        }
+    }
 
-            for (size_t j = 0; j < tmpData.size(); j++) {
-                int ind = arrayInd[n][j];
-                
-                if (ind > -1) {
-                   param[ind][step] = tmpData[j];        
-                }
+    if (columnSteps != resultSteps) {
+        return false;
+    }
+
+    const int fileIndex = static_cast<int>(resultFiles.size());
+    resultFiles.push_back(std::move(columns));
+
+    const size_t nBlocks = blockSeqnum.size();
+
+    for (size_t b = 0; b < nBlocks; b++) {
+        const int nstep = std::get<2>(arrayList[3*b + 1]);
+
+        for (int step = 0; step < nstep; step++) {
+            timeStepList.push_back({fileIndex, static_cast<int>(3*b + 2), run, nstep, step});
+
+            bool lastInReport = (step == nstep - 1) &&
+                ((b == nBlocks - 1) || (blockSeqnum[b + 1] != blockSeqnum[b]));
+
+            if (lastInReport) {
+                reportStepNumber++;
             }
 
+            seqhdrAfter.push_back(lastInReport);
+
             if (reportStepNumber >= toReportStepNumber) {
-                i = arraySourceList.size();
+                return true;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+void ESmry::loadVectors(const std::vector<int>& indices) const
+{
+    std::lock_guard<std::mutex> lock(*this->loadMutex);
+
+    std::vector<int> toLoad;
+
+    for (int ind : indices) {
+        if (!vectorLoaded[ind] && (std::find(toLoad.begin(), toLoad.end(), ind) == toLoad.end())) {
+            toLoad.push_back(ind);
+        }
+    }
+
+    if (toLoad.empty()) {
+        return;
+    }
+
+    for (int ind : toLoad) {
+        param[ind].assign(timeStepList.size(), 0.0);
+    }
+
+    // positions[run] holds PARAMS positions of the vectors to load, vectInd
+    // the corresponding vector. Vectors not found in a run keep default value (0.0)
+
+    std::vector<std::vector<int>> positions(arrayPos.size());
+    std::vector<std::vector<int>> vectInd(arrayPos.size());
+
+    for (size_t run = 0; run < arrayPos.size(); run++) {
+        for (int ind : toLoad) {
+            if (arrayPos[run][ind] > -1) {
+                positions[run].push_back(arrayPos[run][ind]);
+                vectInd[run].push_back(ind);
             }
+        }
+    }
+
+    std::vector<int> elements;
+
+    size_t step = 0;
+    while (step < timeStepList.size()) {
+        const auto& ts = timeStepList[step];
 
+        if (positions[ts.run].empty()) {
             step++;
+            continue;
         }
 
-        fromReportStepNumber = toReportStepNumber;
+        if (ts.stride > 1) {
 
-        n--;
+            // Block of a column file, each vector is contiguous and read
+            // with one call for all time steps of the block.
+
+            size_t last = step + 1;
+            while ((last < timeStepList.size()) &&
+                   (timeStepList[last].file == ts.file) &&
+                   (timeStepList[last].array == ts.array)) {
+                last++;
+            }
+
+            const int count = static_cast<int>(last - step);
+
+            for (size_t j = 0; j < positions[ts.run].size(); j++) {
+                const auto values = resultFiles[ts.file]->getElementRange<float>(ts.array, positions[ts.run][j] * ts.stride + ts.offset, count);
+                std::copy(values.begin(), values.end(), param[vectInd[ts.run][j]].begin() + step);
+            }
+
+            step = last;
+            continue;
+        }
+
+        elements.clear();
+        for (int pos : positions[ts.run]) {
+            elements.push_back(pos * ts.stride + ts.offset);
+        }
+
+        auto values = resultFiles[ts.file]->getElements<float>(ts.array, elements);
+
+        for (size_t j = 0; j < values.size(); j++) {
+            param[vectInd[ts.run][j]][step] = values[j];
+        }
+
+        step++;
     }
 
-    nVect = keywList.size();
+    for (int ind : toLoad) {
+        vectorLoaded[ind] = true;
+    }
+}
 
-    for (auto keyw : keywList){
-        keyword.push_back(keyw);
+
+void ESmry::loadData() const
+{
+    std::vector<int> indices(nVect);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    this->loadVectors(indices);
+}
+
+
+void ESmry::loadData(const std::vector<std::string>& names) const
+{
+    std::vector<int> indices;
+    indices.reserve(names.size());
+
+    for (const auto& name : names) {
+        indices.push_back(getKeywordIndex(name));
     }
+
+    this->loadVectors(indices);
 }
 
 
@@ -421,7 +624,7 @@ void ESmry::updatePathAndRootName(boost::filesystem::path& dir, boost::filesyste
 
 bool ESmry::hasKey(const std::string &key) const
 {
-    return std::find(keyword.begin(), keyword.end(), key) != keyword.end();
+    return keywordIndex.find(key) != keywordIndex.end();
 }
 
 
@@ -495,23 +698,46 @@ std::string ESmry::makeKeyString(const std::string& keywordArg, const std::strin
 }
 
 
-const std::vector<float>& ESmry::get(const std::string& name) const
+int ESmry::getKeywordIndex(const std::string& name) const
 {
-    auto it = std::find(keyword.begin(), keyword.end(), name);
+    auto it = keywordIndex.find(name);
 
-    if (it == keyword.end()) {
+    if (it == keywordIndex.end()) {
         std::string message="keyword " + name + " not found ";
         OPM_THROW(std::invalid_argument, message);
     }
 
-    int ind = std::distance(keyword.begin(), it);
+    return it->second;
+}
+
+
+const std::vector<float>& ESmry::get(const std::string& name) const
+{
+    int ind = getKeywordIndex(name);
+
+    loadVectors({ ind });
 
     return param[ind];
 }
 
+
+std::vector<std::vector<float>> ESmry::get(const std::vector<std::string>& names) const
+{
+    loadData(names);
+
+    std::vector<std::vector<float>> vectors;
+    vectors.reserve(names.size());
+
+    for (const auto& name : names) {
+        vectors.push_back(param[getKeywordIndex(name)]);
+    }
+
+    return vectors;
+}
+
 std::vector<float> ESmry::get_at_rstep(const std::string& name) const
 {
-    std::vector<float> full_vector= this->get(name);
+    const auto& full_vector = this->get(name);
 
     std::vector<float> rstep_vector;
     rstep_vector.reserve(seqIndex.size());
@@ -31,11 +31,24 @@
 #include <string>
 #include <numeric>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define OPM_ECLFILE_HAVE_MMAP 1
+#else
+#define OPM_ECLFILE_HAVE_MMAP 0
+#endif
 
 // anonymous namespace for EclFile
 
 namespace {
 
+// 4 byte control character + 8 byte name + 4 byte #elements + 4 byte
+// type + 4 byte control character.
+constexpr std::size_t binaryHeaderSize = 24;
+
 bool fileExists(const std::string& filename){
 
     std::ifstream fileH(filename.c_str());
@@ -67,14 +80,14 @@ bool isEOF(std::fstream* fileH)
 }
 
 
-void readBinaryHeader(std::fstream& fileH, std::string& arrName,
-                      int& size, Opm::EclIO::eclArrType &arrType)
+void parseBinaryHeader(const char* header, std::string& arrName,
+                       int& size, Opm::EclIO::eclArrType &arrType)
 {
     int bhead;
-    std::string tmpStrName(8,' ');
-    std::string tmpStrType(4,' ');
+    std::string tmpStrName(header + 4, 8);
+    std::string tmpStrType(header + 16, 4);
 
-    fileH.read(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+    std::memcpy(&bhead, header, sizeof(bhead));
     bhead = Opm::EclIO::flipEndianInt(bhead);
 
     if (bhead != 16) {
@@ -82,14 +95,10 @@ void readBinaryHeader(std::fstream& fileH, std::string& arrName,
         OPM_THROW(std::runtime_error, message);
     }
 
-    fileH.read(&tmpStrName[0], 8);
-
-    fileH.read(reinterpret_cast<char*>(&size), sizeof(size));
+    std::memcpy(&size, header + 12, sizeof(size));
     size = Opm::EclIO::flipEndianInt(size);
 
-    fileH.read(&tmpStrType[0], 4);
-
-    fileH.read(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+    std::memcpy(&bhead, header + 20, sizeof(bhead));
     bhead = Opm::EclIO::flipEndianInt(bhead);
 
     if (bhead != 16) {
@@ -115,6 +124,16 @@ void readBinaryHeader(std::fstream& fileH, std::string& arrName,
 }
 
 
+void readBinaryHeader(std::fstream& fileH, std::string& arrName,
+                      int& size, Opm::EclIO::eclArrType &arrType)
+{
+    std::array<char, binaryHeaderSize> header;
+
+    fileH.read(header.data(), header.size());
+    parseBinaryHeader(header.data(), arrName, size, arrType);
+}
+
+
 unsigned long int sizeOnDiskBinary(int num, Opm::EclIO::eclArrType arrType)
 {
     unsigned long int size = 0;
@@ -188,24 +207,54 @@ unsigned long int sizeOnDiskFormatted(const int num, Opm::EclIO::eclArrType arrT
 }
 
 
-template<typename T, typename T2>
-std::vector<T> readBinaryArray(std::fstream& fileH, const int size, Opm::EclIO::eclArrType type,
-                               std::function<T(T2)>& flip)
+void fromFileByteOrder(int* data, std::size_t num)
 {
-    std::vector<T> arr;
+    Opm::EclIO::flipEndianInt(data, num);
+}
+
 
+void fromFileByteOrder(float* data, std::size_t num)
+{
+    Opm::EclIO::flipEndianFloat(data, num);
+}
+
+
+void fromFileByteOrder(double* data, std::size_t num)
+{
+    Opm::EclIO::flipEndianDouble(data, num);
+}
+
+
+int readRecordMarker(const char* data, std::size_t dataSize, std::size_t& pos)
+{
+    if (pos + sizeof(int) > dataSize) {
+        OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of data");
+    }
+
+    int marker;
+    std::memcpy(&marker, data + pos, sizeof(marker));
+    pos += sizeof(marker);
+
+    return Opm::EclIO::flipEndianInt(marker);
+}
+
+
+// Walks the Fortran records holding 'size' elements of type 'type',
+// starting at 'data', and calls processRecord(recordData, num) once per
+// record.  Record markers are validated on the way.
+template<typename ProcessRecord>
+void forEachBinaryRecord(const char* data, std::size_t dataSize, const int size,
+                         Opm::EclIO::eclArrType type, ProcessRecord&& processRecord)
+{
     auto sizeData = block_size_data_binary(type);
     int sizeOfElement = std::get<0>(sizeData);
     int maxBlockSize = std::get<1>(sizeData);
     int maxNumberOfElements = maxBlockSize / sizeOfElement;
 
-    arr.reserve(size);
-
+    std::size_t pos = 0;
     int rest = size;
     while (rest > 0) {
-        int dhead;
-        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-        dhead = Opm::EclIO::flipEndianInt(dhead);
+        int dhead = readRecordMarker(data, dataSize, pos);
 
         int num = dhead / sizeOfElement;
 
@@ -213,12 +262,17 @@ std::vector<T> readBinaryArray(std::fstream& fileH, const int size, Opm::EclIO::
             OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
         }
 
-        for (int i = 0; i < num; i++) {
-            T2 value;
-            fileH.read(reinterpret_cast<char*>(&value), sizeOfElement);
-            arr.push_back(flip(value));
+        if (num > rest) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, record holds more elements than the array");
+        }
+
+        if (pos + static_cast<std::size_t>(num) * sizeOfElement > dataSize) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of data");
         }
 
+        processRecord(data + pos, num);
+        pos += static_cast<std::size_t>(num) * sizeOfElement;
+
         rest -= num;
 
         if (( num < maxNumberOfElements && rest != 0) ||
@@ -227,67 +281,137 @@ std::vector<T> readBinaryArray(std::fstream& fileH, const int size, Opm::EclIO::
             OPM_THROW(std::runtime_error, message);
         }
 
-        int dtail;
-        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
-        dtail = Opm::EclIO::flipEndianInt(dtail);
+        int dtail = readRecordMarker(data, dataSize, pos);
 
         if (dhead != dtail) {
             OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
         }
     }
+}
+
+
+// Numeric arrays are copied one complete record at a time and converted
+// to native byte order in a single pass afterwards.
+template<typename T>
+std::vector<T> readBinaryNumericArray(const char* data, std::size_t dataSize, const int size,
+                                      Opm::EclIO::eclArrType type,
+                                      void (*flip)(T*, std::size_t))
+{
+    std::vector<T> arr(size);
+    T* out = arr.data();
+
+    forEachBinaryRecord(data, dataSize, size, type,
+                        [&out](const char* record, int num)
+                        {
+                            std::memcpy(out, record, num * sizeof(T));
+                            out += num;
+                        });
+
+    flip(arr.data(), arr.size());
 
     return arr;
 }
 
 
-std::vector<int> readBinaryInteArray(std::fstream &fileH, const int size)
+template<typename T, typename T2, typename Convert>
+std::vector<T> readBinaryArray(const char* data, std::size_t dataSize, const int size,
+                               Opm::EclIO::eclArrType type, Convert&& convert)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f);
+    std::vector<T> arr;
+    arr.reserve(size);
+
+    forEachBinaryRecord(data, dataSize, size, type,
+                        [&arr, &convert](const char* record, int num)
+                        {
+                            for (int i = 0; i < num; i++) {
+                                T2 value;
+                                std::memcpy(&value, record + i*sizeof(T2), sizeof(T2));
+                                arr.push_back(convert(value));
+                            }
+                        });
+
+    return arr;
 }
 
 
-std::vector<float> readBinaryRealArray(std::fstream& fileH, const int size)
+std::vector<int> readBinaryInteArray(const char* data, std::size_t dataSize, const int size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f);
+    return readBinaryNumericArray<int>(data, dataSize, size, Opm::EclIO::INTE, Opm::EclIO::flipEndianInt);
 }
 
 
-std::vector<double> readBinaryDoubArray(std::fstream& fileH, const int size)
+std::vector<float> readBinaryRealArray(const char* data, std::size_t dataSize, const int size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f);
+    return readBinaryNumericArray<float>(data, dataSize, size, Opm::EclIO::REAL, Opm::EclIO::flipEndianFloat);
 }
 
-std::vector<bool> readBinaryLogiArray(std::fstream &fileH, const int size)
+
+std::vector<double> readBinaryDoubArray(const char* data, std::size_t dataSize, const int size)
 {
-    std::function<bool(unsigned int)> f = [](unsigned int intVal)
-                                          {
-                                              bool value;
-                                              if (intVal == Opm::EclIO::true_value) {
-                                                  value = true;
-                                              } else if (intVal == Opm::EclIO::false_value) {
-                                                  value = false;
-                                              } else {
-                                                  OPM_THROW(std::runtime_error, "Error reading logi value");
-                                              }
+    return readBinaryNumericArray<double>(data, dataSize, size, Opm::EclIO::DOUB, Opm::EclIO::flipEndianDouble);
+}
 
-                                              return value;
-                                          };
-    return readBinaryArray<bool,unsigned int>(fileH, size, Opm::EclIO::LOGI, f);
+std::vector<bool> readBinaryLogiArray(const char* data, std::size_t dataSize, const int size)
+{
+    auto f = [](unsigned int intVal)
+             {
+                 bool value;
+                 if (intVal == Opm::EclIO::true_value) {
+                     value = true;
+                 } else if (intVal == Opm::EclIO::false_value) {
+                     value = false;
+                 } else {
+                     OPM_THROW(std::runtime_error, "Error reading logi value");
+                 }
+
+                 return value;
+             };
+    return readBinaryArray<bool,unsigned int>(data, dataSize, size, Opm::EclIO::LOGI, f);
 }
 
 
-std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const int size)
+std::vector<std::string> readBinaryCharArray(const char* data, std::size_t dataSize, const int size)
 {
     using Char8 = std::array<char, 8>;
-    std::function<std::string(Char8)> f = [](const Char8& val)
-                                          {
-                                              std::string res(val.begin(), val.end());
-                                              return Opm::EclIO::trimr(res);
-                                          };
-    return readBinaryArray<std::string,Char8>(fileH, size, Opm::EclIO::CHAR, f);
+    auto f = [](const Char8& val)
+             {
+                 std::string res(val.begin(), val.end());
+                 return Opm::EclIO::trimr(res);
+             };
+    return readBinaryArray<std::string,Char8>(data, dataSize, size, Opm::EclIO::CHAR, f);
+}
+
+
+// Stream fallback: reads and decodes the array a bounded number of
+// complete Fortran records at a time, so the temporary buffer does not
+// grow with the size of the array.
+template<typename T>
+std::vector<T> readBinaryArrayBlocked(std::fstream& fileH, const int size,
+                                      Opm::EclIO::eclArrType type,
+                                      std::vector<T> (*decode)(const char*, std::size_t, int))
+{
+    const int recordsPerChunk = 64;
+
+    auto sizeData = block_size_data_binary(type);
+    const int elementsPerChunk = recordsPerChunk * (std::get<1>(sizeData) / std::get<0>(sizeData));
+
+    std::vector<T> arr;
+    arr.reserve(size);
+
+    std::vector<char> buffer;
+    int rest = size;
+    while (rest > 0) {
+        const int num = std::min(rest, elementsPerChunk);
+        buffer.resize(sizeOnDiskBinary(num, type));
+        fileH.read(buffer.data(), buffer.size());
+
+        auto chunk = decode(buffer.data(), static_cast<std::size_t>(fileH.gcount()), num);
+        arr.insert(arr.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+
+        rest -= num;
+    }
+
+    return arr;
 }
 
 
@@ -454,17 +578,30 @@ std::vector<double> readFormattedDoubArray(const std::string& file_str, const in
 
 namespace Opm { namespace EclIO {
 
-EclFile::EclFile(const std::string& filename, bool preload) : inputFilename(filename)
+EclFile::EclFile(const std::string& filename, bool preload, bool memoryMap) : inputFilename(filename)
 {
     if (!fileExists(filename)){
         std::string message="Could not open EclFile: " + filename;
         OPM_THROW(std::invalid_argument, message);
     }
 
-    std::fstream fileH;
-
     formatted = isFormatted(filename);
 
+    if (memoryMap && !formatted) {
+        this->mapFile();
+    }
+
+    if (this->mappedData) {
+        this->scanMappedHeaders();
+
+        if (preload)
+            this->loadData();
+
+        return;
+    }
+
+    std::fstream fileH;
+
     if (formatted) {
         fileH.open(filename, std::ios::in);
     } else {
@@ -519,25 +656,153 @@ EclFile::EclFile(const std::string& filename, bool preload) : inputFilename(file
 }
 
 
+void EclFile::mapFile()
+{
+#if OPM_ECLFILE_HAVE_MMAP
+    const int fd = ::open(inputFilename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::string message="Could not open file: " + inputFilename;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    struct stat st;
+    if ((::fstat(fd, &st) != 0) || (st.st_size == 0)) {
+        // Empty or unknown size, leave it to the stream based reader
+        ::close(fd);
+        return;
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (addr == MAP_FAILED) {
+        // Mapping is an optimisation only, fall back to std::fstream.
+        return;
+    }
+
+    this->mappedSize = size;
+    this->mappedData = std::shared_ptr<const char> {
+        static_cast<const char*>(addr),
+        [size](const char* p) { ::munmap(const_cast<char*>(p), size); }
+    };
+#endif
+}
+
+
+void EclFile::scanMappedHeaders()
+{
+    const char* data = this->mappedData.get();
+    std::size_t pos = 0;
+
+    int n = 0;
+    while (pos + sizeof(int) <= this->mappedSize) {
+        if (pos + binaryHeaderSize > this->mappedSize) {
+            OPM_THROW(std::runtime_error, "Error reading binary header, unexpected end of file " + inputFilename);
+        }
+
+        std::string arrName;
+        eclArrType arrType;
+        int num;
+
+        parseBinaryHeader(data + pos, arrName, num, arrType);
+        pos += binaryHeaderSize;
+
+        array_size.push_back(num);
+        array_type.push_back(arrType);
+
+        array_name.push_back(trimr(arrName));
+        array_index[array_name[n]] = n;
+
+        ifStreamPos.push_back(pos);
+
+        arrayLoaded.push_back(false);
+
+        pos += sizeOnDiskBinary(num, arrType);
+
+        n++;
+    }
+
+    this->ifStreamPos.push_back(static_cast<unsigned long>(this->mappedSize));
+}
+
+
+void EclFile::loadBinaryArrays(const std::vector<int>& arrIndex)
+{
+    if (this->mappedData) {
+        for (int ind : arrIndex) {
+            const auto pos = std::min(static_cast<std::size_t>(ifStreamPos[ind]), this->mappedSize);
+            loadBinaryArray(this->mappedData.get() + pos, this->mappedSize - pos, ind);
+        }
+
+        return;
+    }
+
+    std::fstream fileH;
+    fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    for (int ind : arrIndex) {
+        loadBinaryArray(fileH, ind);
+    }
+
+    fileH.close();
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
     case INTE:
-        inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
+        inte_array[arrIndex] = readBinaryArrayBlocked(fileH, array_size[arrIndex], INTE, readBinaryInteArray);
         break;
     case REAL:
-        real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
+        real_array[arrIndex] = readBinaryArrayBlocked(fileH, array_size[arrIndex], REAL, readBinaryRealArray);
         break;
     case DOUB:
-        doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
+        doub_array[arrIndex] = readBinaryArrayBlocked(fileH, array_size[arrIndex], DOUB, readBinaryDoubArray);
         break;
     case LOGI:
-        logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
+        logi_array[arrIndex] = readBinaryArrayBlocked(fileH, array_size[arrIndex], LOGI, readBinaryLogiArray);
         break;
     case CHAR:
-        char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
+        char_array[arrIndex] = readBinaryArrayBlocked(fileH, array_size[arrIndex], CHAR, readBinaryCharArray);
+        break;
+    case MESS:
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        break;
+    }
+
+    arrayLoaded[arrIndex] = true;
+}
+
+
+void EclFile::loadBinaryArray(const char* data, std::size_t dataSize, std::size_t arrIndex)
+{
+
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = readBinaryInteArray(data, dataSize, array_size[arrIndex]);
+        break;
+    case REAL:
+        real_array[arrIndex] = readBinaryRealArray(data, dataSize, array_size[arrIndex]);
+        break;
+    case DOUB:
+        doub_array[arrIndex] = readBinaryDoubArray(data, dataSize, array_size[arrIndex]);
+        break;
+    case LOGI:
+        logi_array[arrIndex] = readBinaryLogiArray(data, dataSize, array_size[arrIndex]);
+        break;
+    case CHAR:
+        char_array[arrIndex] = readBinaryCharArray(data, dataSize, array_size[arrIndex]);
         break;
     case MESS:
         break;
@@ -591,19 +856,10 @@ void EclFile::loadData()
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+        std::vector<int> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -636,21 +892,15 @@ void EclFile::loadData(const std::string& name)
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
+        std::vector<int> arrIndices;
 
         for (size_t i = 0; i < array_name.size(); i++) {
             if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
+                arrIndices.push_back(i);
             }
         }
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -679,19 +929,7 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
-        }
-
-        fileH.close();
+        this->loadBinaryArrays(arrIndex);
     }
 }
 
@@ -718,17 +956,7 @@ void EclFile::loadData(int arrIndex)
 
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        loadBinaryArray(fileH, arrIndex);
-
-        fileH.close();
+        this->loadBinaryArrays({ arrIndex });
     }
 }
 
@@ -780,6 +1008,209 @@ const std::vector<std::string>& EclFile::get<std::string>(int arrIndex)
 }
 
 
+template<class T>
+std::vector<T> EclFile::getElementsImpl(int arrIndex, eclArrType type,
+                                        const std::unordered_map<int, std::vector<T>>& array,
+                                        const std::string& typeStr,
+                                        const std::vector<int>& elements)
+{
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    for (int elm : elements) {
+        if ((elm < 0) || (elm >= array_size[arrIndex])) {
+            std::string message = "Element " + std::to_string(elm) + " out of range for array with index " + std::to_string(arrIndex);
+            OPM_THROW(std::invalid_argument, message);
+        }
+    }
+
+    std::vector<T> values;
+    values.reserve(elements.size());
+
+    if (formatted || arrayLoaded[arrIndex]) {
+        const auto& arr = getImpl(arrIndex, type, array, typeStr);
+
+        for (int elm : elements) {
+            values.push_back(arr[elm]);
+        }
+
+        return values;
+    }
+
+    auto sizeData = block_size_data_binary(type);
+    const std::size_t sizeOfElement = std::get<0>(sizeData);
+    const std::size_t maxBlockSize = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    // Skip leading record marker, complete records (data and both
+    // markers), then elements within the record.
+    auto elementPos = [&](const int elm) -> std::size_t
+    {
+        const std::size_t e = elm;
+        return ifStreamPos[arrIndex] + sizeof(int)
+            + (e / maxNumberOfElements) * (maxBlockSize + 2*sizeof(int))
+            + (e % maxNumberOfElements) * sizeOfElement;
+    };
+
+    if (this->mappedData) {
+        for (int elm : elements) {
+            const auto pos = elementPos(elm);
+
+            if (pos + sizeof(T) > this->mappedSize) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file " + inputFilename);
+            }
+
+            T value;
+            std::memcpy(&value, this->mappedData.get() + pos, sizeof(T));
+            values.push_back(value);
+        }
+    } else {
+        std::fstream fileH;
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+        if (!fileH) {
+            std::string message="Could not open file: '" + inputFilename +"'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        for (int elm : elements) {
+            T value;
+            fileH.seekg(elementPos(elm), fileH.beg);
+            fileH.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+            if (!fileH) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file " + inputFilename);
+            }
+
+            values.push_back(value);
+        }
+    }
+
+    fromFileByteOrder(values.data(), values.size());
+
+    return values;
+}
+
+
+template<class T>
+std::vector<T> EclFile::getElementRangeImpl(int arrIndex, eclArrType type,
+                                            const std::unordered_map<int, std::vector<T>>& array,
+                                            const std::string& typeStr,
+                                            int first, int count)
+{
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if ((first < 0) || (count < 0) || (first > array_size[arrIndex] - count)) {
+        std::string message = "Elements " + std::to_string(first) + " ... " + std::to_string(first + count - 1)
+            + " out of range for array with index " + std::to_string(arrIndex);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    if (formatted || arrayLoaded[arrIndex]) {
+        const auto& arr = getImpl(arrIndex, type, array, typeStr);
+        return std::vector<T>(arr.begin() + first, arr.begin() + first + count);
+    }
+
+    std::vector<T> values(count);
+
+    auto sizeData = block_size_data_binary(type);
+    const std::size_t sizeOfElement = std::get<0>(sizeData);
+    const std::size_t maxBlockSize = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    std::fstream fileH;
+    if (!this->mappedData) {
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+        if (!fileH) {
+            std::string message="Could not open file: '" + inputFilename +"'";
+            OPM_THROW(std::runtime_error, message);
+        }
+    }
+
+    // One read for the part of the range within each record.
+
+    std::size_t e = first;
+    std::size_t done = 0;
+    while (done < values.size()) {
+        const std::size_t num = std::min(values.size() - done, maxNumberOfElements - e % maxNumberOfElements);
+        const std::size_t pos = ifStreamPos[arrIndex] + sizeof(int)
+            + (e / maxNumberOfElements) * (maxBlockSize + 2*sizeof(int))
+            + (e % maxNumberOfElements) * sizeOfElement;
+
+        if (this->mappedData) {
+            if (pos + num * sizeof(T) > this->mappedSize) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file " + inputFilename);
+            }
+
+            std::memcpy(values.data() + done, this->mappedData.get() + pos, num * sizeof(T));
+        } else {
+            fileH.seekg(pos, fileH.beg);
+            fileH.read(reinterpret_cast<char*>(values.data() + done), num * sizeof(T));
+
+            if (!fileH) {
+                OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file " + inputFilename);
+            }
+        }
+
+        e += num;
+        done += num;
+    }
+
+    fromFileByteOrder(values.data(), values.size());
+
+    return values;
+}
+
+
+template<>
+std::vector<int> EclFile::getElements<int>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, INTE, inte_array, "integer", elements);
+}
+
+
+template<>
+std::vector<float> EclFile::getElements<float>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, REAL, real_array, "float", elements);
+}
+
+
+template<>
+std::vector<double> EclFile::getElements<double>(int arrIndex, const std::vector<int>& elements)
+{
+    return getElementsImpl(arrIndex, DOUB, doub_array, "double", elements);
+}
+
+
+
+template<>
+std::vector<int> EclFile::getElementRange<int>(int arrIndex, int first, int count)
+{
+    return getElementRangeImpl(arrIndex, INTE, inte_array, "integer", first, count);
+}
+
+
+template<>
+std::vector<float> EclFile::getElementRange<float>(int arrIndex, int first, int count)
+{
+    return getElementRangeImpl(arrIndex, REAL, real_array, "float", first, count);
+}
+
+
+template<>
+std::vector<double> EclFile::getElementRange<double>(int arrIndex, int first, int count)
+{
+    return getElementRangeImpl(arrIndex, DOUB, doub_array, "double", first, count);
+}
+
+
 bool EclFile::hasKey(const std::string &name) const
 {
     auto search = array_index.find(name);
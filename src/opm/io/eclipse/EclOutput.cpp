@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <iterator>
@@ -32,6 +33,60 @@
 #include <sstream>
 #include <stdexcept>
 #include <typeinfo>
+#include <vector>
+
+namespace {
+
+// Element type of a binary record on disk.
+template <typename T>
+struct BinaryElement
+{
+    using type = T;
+};
+
+template <>
+struct BinaryElement<bool>
+{
+    using type = unsigned int;
+};
+
+void toFileByteOrder(int* data, std::size_t num)
+{
+    Opm::EclIO::flipEndianInt(data, num);
+}
+
+void toFileByteOrder(float* data, std::size_t num)
+{
+    Opm::EclIO::flipEndianFloat(data, num);
+}
+
+void toFileByteOrder(double* data, std::size_t num)
+{
+    Opm::EclIO::flipEndianDouble(data, num);
+}
+
+void toFileByteOrder(char*, std::size_t)
+{
+    // Type MESS, no associated data
+}
+
+template <typename T>
+void copyRecord(const std::vector<T>& data, std::size_t first, int num, T* record)
+{
+    std::copy(data.begin() + first, data.begin() + first + num, record);
+    toFileByteOrder(record, num);
+}
+
+void copyRecord(const std::vector<bool>& data, std::size_t first, int num, unsigned int* record)
+{
+    std::transform(data.begin() + first, data.begin() + first + num, record,
+                   [](const bool value)
+                   {
+                       return value ? Opm::EclIO::true_value : Opm::EclIO::false_value;
+                   });
+}
+
+} // anonymous namespace
 
 namespace Opm { namespace EclIO {
 
@@ -91,6 +146,15 @@ void EclOutput::flushStream()
     this->ofileH.flush();
 }
 
+std::size_t EclOutput::blockElements(eclArrType arrType) const
+{
+    if (isFormatted)
+        return std::get<0>(block_size_data_formatted(arrType));
+
+    const auto sizeData = block_size_data_binary(arrType);
+    return std::get<1>(sizeData) / std::get<0>(sizeData);
+}
+
 void EclOutput::writeBinaryHeader(const std::string&arrName, int size, eclArrType arrType)
 {
     std::string name = arrName + std::string(8 - arrName.size(),' ');
@@ -131,13 +195,10 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int size, eclArrTyp
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
-    int rest,num,rval;
+    int rest,num;
     int dhead;
-    float value_f;
-    double value_d;
-    int intVal;
 
-    int n = 0;
+    std::size_t n = 0;
     int size = data.size();
 
     eclArrType arrType = MESS;
@@ -162,6 +223,10 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    // Each record is converted to file byte order in a buffer and
+    // written with a single call.
+    std::vector<typename BinaryElement<T>::type> record(maxNumberOfElements);
+
     rest = size * sizeOfElement;
     while (rest > 0) {
         if (rest > maxBlockSize) {
@@ -174,30 +239,12 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         dhead = flipEndianInt(num * sizeOfElement);
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        for (int i = 0; i < num; i++) {
-            if (arrType == INTE) {
-                rval = flipEndianInt(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&rval), sizeof(rval));
-            } else if (arrType == REAL) {
-                value_f = flipEndianFloat(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_f), sizeof(value_f));
-            } else if (arrType == DOUB) {
-                value_d = flipEndianDouble(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_d), sizeof(value_d));
-            } else if (arrType == LOGI) {
-                intVal = data[n] ? true_value : false_value;
-                ofileH.write(reinterpret_cast<char*>(&intVal), sizeOfElement);
-            } else {
-                std::cerr << "type not supported in write binaryarray\n";
-                std::exit(EXIT_FAILURE);
-            }
-
-            n++;
-        }
+        copyRecord(data, n, num, record.data());
+        n += num;
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        ofileH.write(reinterpret_cast<const char*>(record.data()), num * sizeOfElement);
+        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -21,35 +21,110 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 
+namespace {
+
+std::uint32_t byteSwap(std::uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(x);
+#else
+    return ((x & 0x000000FFu) << 24) | ((x & 0x0000FF00u) <<  8)
+         | ((x & 0x00FF0000u) >>  8) | ((x & 0xFF000000u) >> 24);
+#endif
+}
+
+std::uint64_t byteSwap(std::uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(x);
+#else
+    return (static_cast<std::uint64_t>(byteSwap(static_cast<std::uint32_t>(x))) << 32)
+         | byteSwap(static_cast<std::uint32_t>(x >> 32));
+#endif
+}
+
+// Values are moved through a local block of unsigned words of the same
+// size.  This keeps the conversion free of aliasing violations, and the
+// inner loop is a plain element-wise byte swap which the compiler turns
+// into SSE/AVX2/NEON shuffles where available.
+template <typename Word, typename T>
+void flipEndianBlock(T* data, std::size_t num)
+{
+    static_assert(sizeof(Word) == sizeof(T), "Word size must match value size");
+
+    constexpr std::size_t blockSize = 1024;
+    std::array<Word, blockSize> block;
+
+    while (num > 0) {
+        const auto n = std::min(num, blockSize);
+
+        std::memcpy(block.data(), data, n * sizeof(T));
+
+        for (std::size_t i = 0; i < n; i++) {
+            block[i] = byteSwap(block[i]);
+        }
+
+        std::memcpy(data, block.data(), n * sizeof(T));
+
+        data += n;
+        num -= n;
+    }
+}
+
+template <typename Word, typename T>
+T flipEndianValue(T num)
+{
+    static_assert(sizeof(Word) == sizeof(T), "Word size must match value size");
+
+    Word tmp;
+    std::memcpy(&tmp, &num, sizeof(tmp));
+    tmp = byteSwap(tmp);
+    std::memcpy(&num, &tmp, sizeof(num));
+
+    return num;
+}
+
+} // anonymous namespace
+
 
 int Opm::EclIO::flipEndianInt(int num)
 {
-    unsigned int tmp = __builtin_bswap32(num);
-    return static_cast<int>(tmp);
+    return flipEndianValue<std::uint32_t>(num);
 }
 
 
 float Opm::EclIO::flipEndianFloat(float num)
 {
-    float value = num;
+    return flipEndianValue<std::uint32_t>(num);
+}
+
+
+double Opm::EclIO::flipEndianDouble(double num)
+{
+    return flipEndianValue<std::uint64_t>(num);
+}
 
-    char* floatToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(floatToConvert, floatToConvert+4);
 
-    return value;
+void Opm::EclIO::flipEndianInt(int* data, std::size_t num)
+{
+    flipEndianBlock<std::uint32_t>(data, num);
 }
 
 
-double Opm::EclIO::flipEndianDouble(double num)
+void Opm::EclIO::flipEndianFloat(float* data, std::size_t num)
 {
-    double value = num;
+    flipEndianBlock<std::uint32_t>(data, num);
+}
 
-    char* doubleToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(doubleToConvert, doubleToConvert+8);
 
-    return value;
+void Opm::EclIO::flipEndianDouble(double* data, std::size_t num)
+{
+    flipEndianBlock<std::uint64_t>(data, num);
 }
 
 
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <ctime>
 #include <exception>
 #include <fstream>
@@ -86,6 +87,11 @@ namespace {
             return formatted ? "FSMSPEC" : "SMSPEC";
         }
 
+        std::string summaryColumns(const bool formatted)
+        {
+            return formatted ? "FUCSMRY" : "UCSMRY";
+        }
+
         std::string summary(const int  rptStep,
                             const bool formatted,
                             const bool unified)
@@ -204,6 +210,20 @@ namespace {
                 };
             }
         } // namespace Smspec
+
+        namespace SummaryColumns
+        {
+            std::unique_ptr<Opm::EclIO::EclOutput>
+            writeNew(const std::string& filename,
+                     const bool         isFmt)
+            {
+                return std::unique_ptr<Opm::EclIO::EclOutput> {
+                    new Opm::EclIO::EclOutput {
+                        filename, isFmt, std::ios_base::out
+                    }
+                };
+            }
+        } // namespace SummaryColumns
     } // namespace Open
 } // Anonymous namespace
 
@@ -261,6 +281,15 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Init::
+write(const std::string&                        kw,
+      const std::size_t                         size,
+      const std::function<float(std::size_t)>& value)
+{
+    this->stream().write<float>(kw, size, value);
+}
+
 void
 Opm::EclIO::OutputStream::Init::
 open(const std::string& fname,
@@ -778,6 +807,107 @@ Opm::EclIO::OutputStream::SummarySpecification::stream()
 
 // =====================================================================
 
+Opm::EclIO::OutputStream::SummaryColumns::
+SummaryColumns(const ResultSet& rset,
+               const Formatted& fmt,
+               const int        numParams)
+    : numParams_(numParams)
+{
+    const auto fname = outputFileName(rset, FileExtension::summaryColumns(fmt.set));
+
+    this->stream_ = Open::SummaryColumns::writeNew(fname, fmt.set);
+}
+
+Opm::EclIO::OutputStream::SummaryColumns::~SummaryColumns()
+{}
+
+Opm::EclIO::OutputStream::SummaryColumns::
+SummaryColumns(SummaryColumns&& rhs)
+    : numParams_(rhs.numParams_)
+    , seqnum_   (rhs.seqnum_)
+    , ministeps_(std::move(rhs.ministeps_))
+    , rows_     (std::move(rhs.rows_))
+    , stream_   (std::move(rhs.stream_))
+{}
+
+Opm::EclIO::OutputStream::SummaryColumns&
+Opm::EclIO::OutputStream::SummaryColumns::
+operator=(SummaryColumns&& rhs)
+{
+    this->numParams_ = rhs.numParams_;
+    this->seqnum_    = rhs.seqnum_;
+    this->ministeps_ = std::move(rhs.ministeps_);
+    this->rows_      = std::move(rhs.rows_);
+    this->stream_    = std::move(rhs.stream_);
+
+    return *this;
+}
+
+void
+Opm::EclIO::OutputStream::SummaryColumns::
+add(const int                 seqnum,
+    const int                 ministep,
+    const std::vector<float>& params)
+{
+    if (params.size() != static_cast<std::vector<float>::size_type>(this->numParams_)) {
+        throw std::invalid_argument {
+            "Number of summary parameters (" + std::to_string(params.size())
+            + ") does not match column file layout ("
+            + std::to_string(this->numParams_) + ')'
+        };
+    }
+
+    if (! this->ministeps_.empty() && (seqnum != this->seqnum_)) {
+        this->writeBlock();
+    }
+
+    this->seqnum_ = seqnum;
+    this->ministeps_.push_back(ministep);
+    this->rows_.insert(this->rows_.end(), params.begin(), params.end());
+}
+
+void Opm::EclIO::OutputStream::SummaryColumns::write()
+{
+    if (! this->ministeps_.empty()) {
+        this->writeBlock();
+    }
+
+    this->stream().flushStream();
+}
+
+void Opm::EclIO::OutputStream::SummaryColumns::writeBlock()
+{
+    const auto nstep  = this->ministeps_.size();
+    const auto nparam = static_cast<std::size_t>(this->numParams_);
+
+    // Transpose buffered rows into one contiguous column per parameter.
+    auto columns = std::vector<float>(nstep * nparam);
+    for (auto step = 0*nstep; step < nstep; ++step) {
+        const auto* row = &this->rows_[step * nparam];
+
+        for (auto p = 0*nparam; p < nparam; ++p) {
+            columns[p*nstep + step] = row[p];
+        }
+    }
+
+    auto& os = this->stream();
+
+    os.write("SEQHDR"  , std::vector<int>{ this->seqnum_ });
+    os.write("MINISTEP", this->ministeps_);
+    os.write("COLUMNS" , columns);
+
+    this->ministeps_.clear();
+    this->rows_.clear();
+}
+
+Opm::EclIO::EclOutput&
+Opm::EclIO::OutputStream::SummaryColumns::stream()
+{
+    return *this->stream_;
+}
+
+// =====================================================================
+
 std::unique_ptr<Opm::EclIO::EclOutput>
 Opm::EclIO::OutputStream::createSummaryFile(const ResultSet& rset,
                                             const int        seqnum,
@@ -24,6 +24,8 @@
 
 #include <opm/output/eclipse/EclipseIO.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp>
@@ -46,11 +48,17 @@
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdlib>
 #include <cctype>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 
@@ -91,6 +99,145 @@ void ensure_directory_exists( const boost::filesystem::path& odir )
     }
 }
 
+/*
+  Runs output tasks, in submission order, on a dedicated thread. At most
+  maxPending tasks are queued; submit() blocks while the queue is full. The
+  first exception thrown by a task is stored and rethrown from the next
+  call to submit() or flush(); later tasks are discarded. A failure which
+  has not been rethrown when the writer is destroyed is logged.
+*/
+class BackgroundWriter
+{
+public:
+    explicit BackgroundWriter(const std::size_t maxPending)
+        : maxPending_(std::max(maxPending, std::size_t{1}))
+        , thread_([this]() { this->run(); })
+    {}
+
+    ~BackgroundWriter()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->taskAvailable_.notify_all();
+        this->thread_.join();
+
+        if (! this->failure_)
+            return;
+
+        try {
+            std::rethrow_exception(this->failure_);
+        }
+        catch (const std::exception& e) {
+            Opm::OpmLog::error("Asynchronous output failed, output files may be incomplete: " + std::string(e.what()));
+        }
+        catch (...) {
+            Opm::OpmLog::error("Asynchronous output failed, output files may be incomplete");
+        }
+    }
+
+    BackgroundWriter(const BackgroundWriter&) = delete;
+    BackgroundWriter& operator=(const BackgroundWriter&) = delete;
+
+    void submit(std::function<void()> task)
+    {
+        std::unique_lock<std::mutex> lock{ this->mutex_ };
+        this->spaceAvailable_.wait(lock, [this]()
+        {
+            return this->failure_ || (this->tasks_.size() < this->maxPending_);
+        });
+
+        this->rethrowFailure();
+
+        this->tasks_.push_back(std::move(task));
+        lock.unlock();
+
+        this->taskAvailable_.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock{ this->mutex_ };
+        this->idle_.wait(lock, [this]()
+        {
+            return this->tasks_.empty() && !this->busy_;
+        });
+
+        this->rethrowFailure();
+    }
+
+private:
+    std::size_t maxPending_;
+    std::deque<std::function<void()>> tasks_{};
+    std::exception_ptr failure_{};
+    bool busy_{false};
+    bool stop_{false};
+
+    std::mutex mutex_{};
+    std::condition_variable taskAvailable_{};
+    std::condition_variable spaceAvailable_{};
+    std::condition_variable idle_{};
+
+    // Declared last so that it is started after all other members are
+    // initialised.
+    std::thread thread_;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock{ this->mutex_ };
+
+        while (true) {
+            this->taskAvailable_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->tasks_.empty();
+            });
+
+            if (this->tasks_.empty())
+                // Stop requested and all output written.
+                return;
+
+            auto task = std::move(this->tasks_.front());
+            this->tasks_.pop_front();
+            this->busy_ = true;
+
+            const auto skip = static_cast<bool>(this->failure_);
+            lock.unlock();
+            this->spaceAvailable_.notify_one();
+
+            auto failure = std::exception_ptr{};
+            if (! skip) {
+                try {
+                    task();
+                }
+                catch (...) {
+                    failure = std::current_exception();
+                }
+            }
+
+            lock.lock();
+            this->busy_ = false;
+            if (failure && !this->failure_)
+                this->failure_ = failure;
+
+            this->spaceAvailable_.notify_all();
+            this->idle_.notify_all();
+        }
+    }
+
+    void rethrowFailure()
+    {
+        if (! this->failure_)
+            return;
+
+        auto failure = this->failure_;
+        this->failure_ = nullptr;
+
+        std::rethrow_exception(failure);
+    }
+};
+
 }
 
 namespace Opm {
@@ -99,6 +246,8 @@ class EclipseIO::Impl {
     Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& );
         void writeINITFile( const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const NNC& nnc) const;
         void writeEGRIDFile( const NNC& nnc );
+        void writeOutput( const SummaryState& st, int report_step, bool isSubstep,
+                          double secs_elapsed, RestartValue value, bool write_double );
 
         const EclipseState& es;
         EclipseGrid grid;
@@ -107,6 +256,14 @@ class EclipseIO::Impl {
         std::string baseName;
         out::Summary summary;
         bool output_enabled;
+
+        // Serialises add_timestep() on the simulator thread with
+        // write() on the output thread.
+        std::mutex summary_mutex;
+
+        // Destroyed first, i.e. pending output is written before any of
+        // the above members go away.
+        std::unique_ptr<BackgroundWriter> writer;
 };
 
 EclipseIO::Impl::Impl( const EclipseState& eclipseState,
@@ -173,31 +330,18 @@ void EclipseIO::writeInitial( data::Solution simProps, std::map<std::string, std
 
 }
 
-// implementation of the writeTimeStep method
-void EclipseIO::writeTimeStep(const SummaryState& st,
-                              int report_step,
-                              bool  isSubstep,
-                              double secs_elapsed,
-                              RestartValue value,
-                              const bool write_double)
- {
-    if (! this->impl->output_enabled) {
-        return;
-    }
-
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
-    const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
+void EclipseIO::Impl::writeOutput(const SummaryState& st,
+                                  int report_step,
+                                  bool isSubstep,
+                                  double secs_elapsed,
+                                  RestartValue value,
+                                  const bool write_double)
+{
+    const auto& ioConfig = this->es.cfg().io();
 
-    /*
-      Summary data is written unconditionally for every timestep except for the
-      very intial report_step==0 call, which is only garbage.
-    */
     if (report_step > 0) {
-        this->impl->summary.add_timestep( st,
-                                          report_step);
-        this->impl->summary.write();
+        std::lock_guard<std::mutex> lock{ this->summary_mutex };
+        this->summary.write();
     }
 
     /*
@@ -205,18 +349,18 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
       but there is an unsupported option to the RPTSCHED keyword which
       will request restart output from every timestep.
     */
-    if(!isSubstep && es.cfg().restart().getWriteRestartFile(report_step))
+    if(!isSubstep && this->es.cfg().restart().getWriteRestartFile(report_step))
     {
         EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             report_step,
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
         };
 
         RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, st, write_double);
+                        this->es, this->grid, this->schedule, st, write_double);
     }
 
     // RFT file is not written for substeps
@@ -224,22 +368,75 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
         // Open existing RFT file if report step is after first RFT event.
         const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
             static_cast<std::size_t>(report_step)
-            > schedule.rftConfig().firstRFTOutput()
+            > this->schedule.rftConfig().firstRFTOutput()
         };
 
         EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             openExisting
         };
 
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+        RftIO::write(report_step, secs_elapsed, this->es.getUnits(),
+                     this->grid, this->schedule, value.wells, rftFile);
+    }
+}
+
+// implementation of the writeTimeStep method
+void EclipseIO::writeTimeStep(const SummaryState& st,
+                              int report_step,
+                              bool  isSubstep,
+                              double secs_elapsed,
+                              RestartValue value,
+                              const bool write_double)
+ {
+    if (! this->impl->output_enabled) {
+        return;
     }
+
+    /*
+      Summary data is written unconditionally for every timestep except for the
+      very intial report_step==0 call, which is only garbage.
+    */
+    if (report_step > 0) {
+        std::lock_guard<std::mutex> lock{ this->impl->summary_mutex };
+        this->impl->summary.add_timestep( st,
+                                          report_step);
+    }
+
+    if (! this->impl->writer) {
+        this->impl->writeOutput(st, report_step, isSubstep, secs_elapsed,
+                                std::move(value), write_double);
+        return;
+    }
+
+    auto* impl_ptr = this->impl.get();
+    auto st_copy = std::make_shared<SummaryState>(st);
+    auto value_ptr = std::make_shared<RestartValue>(std::move(value));
+
+    this->impl->writer->submit([=]()
+    {
+        impl_ptr->writeOutput(*st_copy, report_step, isSubstep, secs_elapsed,
+                              std::move(*value_ptr), write_double);
+    });
  }
 
 
+void EclipseIO::enableAsyncOutput(std::size_t max_pending) {
+    if (this->impl->writer)
+        this->impl->writer->flush();
+
+    this->impl->writer.reset(new BackgroundWriter(max_pending));
+}
+
+
+void EclipseIO::flushOutput() {
+    if (this->impl->writer)
+        this->impl->writer->flush();
+}
+
+
 RestartValue EclipseIO::loadRestart(SummaryState& summary_state, const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys) const {
     const auto& es                       = this->impl->es;
     const auto& grid                     = this->impl->grid;
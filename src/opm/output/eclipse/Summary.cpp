@@ -57,10 +57,12 @@
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -316,11 +318,12 @@ struct quantity {
  * All functions must have the same parameters, so they're gathered in a struct
  * and functions use whatever information they care about.
  *
- * schedule_wells are wells from the deck, provided by opm-parser. active_index
+ * schedule_wells are wells from the deck, provided by opm-parser and owned by
+ * the Schedule; they are only valid for the duration of one evaluation. active_index
  * is the index of the block in question. wells is simulation data.
  */
 struct fn_args {
-    const std::vector<Opm::Well>& schedule_wells;
+    const std::vector<const Opm::Well*>& schedule_wells;
     double duration;
     const int sim_step;
     int  num;
@@ -389,14 +392,14 @@ template< rt phase, bool injection = true, bool polymer = false >
 inline quantity rate( const fn_args& args ) {
     double sum = 0.0;
 
-    for( const auto& sched_well : args.schedule_wells ) {
-        const auto& name = sched_well.name();
+    for( const auto* sched_well : args.schedule_wells ) {
+        const auto& name = sched_well->name();
         if( args.wells.count( name ) == 0 ) continue;
 
         double eff_fac = efac( args.eff_factors, name );
 
         double concentration = polymer
-                             ? sched_well.getPolymerProperties().m_polymerConcentration
+                             ? sched_well->getPolymerProperties().m_polymerConcentration
                              : 1;
 
         const auto v = args.wells.at(name).rates.get(phase, 0.0) * eff_fac * concentration;
@@ -414,9 +417,9 @@ inline quantity rate( const fn_args& args ) {
 template< bool injection >
 inline quantity flowing( const fn_args& args ) {
     const auto& wells = args.wells;
-    auto pred = [&wells]( const Opm::Well& w ) {
-        const auto& name = w.name();
-        return w.isInjector( ) == injection
+    auto pred = [&wells]( const Opm::Well* w ) {
+        const auto& name = w->name();
+        return w->isInjector( ) == injection
             && wells.count( name ) > 0
             && wells.at( name ).flowing();
     };
@@ -437,7 +440,7 @@ inline quantity crate( const fn_args& args ) {
     const size_t global_index = args.num - 1;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -473,7 +476,7 @@ inline quantity srate( const fn_args& args ) {
     const size_t segNumber = args.num;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -504,7 +507,7 @@ inline quantity trans_factors ( const fn_args& args ) {
     // up a connection with offset 0.
     const size_t global_index = args.num - 1;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -533,7 +536,7 @@ inline quantity spr ( const fn_args& args ) {
     const size_t segNumber = args.num;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -553,7 +556,7 @@ inline quantity bhp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front().name() );
+    const auto p = args.wells.find( args.schedule_wells.front()->name() );
     if( p == args.wells.end() ) return zero;
 
     return { p->second.bhp, measure::pressure };
@@ -563,7 +566,7 @@ inline quantity thp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front().name() );
+    const auto p = args.wells.find( args.schedule_wells.front()->name() );
     if( p == args.wells.end() ) return zero;
 
     return { p->second.thp, measure::pressure };
@@ -572,7 +575,7 @@ inline quantity thp( const fn_args& args ) {
 inline quantity bhp_history( const fn_args& args ) {
     if( args.schedule_wells.empty() ) return { 0.0, measure::pressure };
 
-    const Opm::Well& sched_well = args.schedule_wells.front();
+    const Opm::Well& sched_well = *args.schedule_wells.front();
 
     double bhp_hist;
     if ( sched_well.isProducer(  ) )
@@ -586,7 +589,7 @@ inline quantity bhp_history( const fn_args& args ) {
 inline quantity thp_history( const fn_args& args ) {
     if( args.schedule_wells.empty() ) return { 0.0, measure::pressure };
 
-    const Opm::Well& sched_well = args.schedule_wells.front();
+    const Opm::Well& sched_well = *args.schedule_wells.front();
 
     double thp_hist;
     if ( sched_well.isProducer() )
@@ -607,10 +610,10 @@ inline quantity production_history( const fn_args& args ) {
      */
 
     double sum = 0.0;
-    for( const auto& sched_well : args.schedule_wells ){
+    for( const auto* sched_well : args.schedule_wells ){
 
-        double eff_fac = efac( args.eff_factors, sched_well.name() );
-        sum += sched_well.production_rate( args.st, phase ) * eff_fac;
+        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        sum += sched_well->production_rate( args.st, phase ) * eff_fac;
     }
 
 
@@ -621,9 +624,9 @@ template< Opm::Phase phase >
 inline quantity injection_history( const fn_args& args ) {
 
     double sum = 0.0;
-    for( const auto& sched_well : args.schedule_wells ){
-        double eff_fac = efac( args.eff_factors, sched_well.name() );
-        sum += sched_well.injection_rate( args.st, phase ) * eff_fac;
+    for( const auto* sched_well : args.schedule_wells ){
+        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        sum += sched_well->injection_rate( args.st, phase ) * eff_fac;
     }
 
 
@@ -633,9 +636,9 @@ inline quantity injection_history( const fn_args& args ) {
 inline quantity res_vol_production_target( const fn_args& args ) {
 
     double sum = 0.0;
-    for( const Opm::Well& sched_well : args.schedule_wells )
-        if (sched_well.getProductionProperties().predictionMode)
-            sum += sched_well.getProductionProperties().ResVRate.getSI();
+    for( const Opm::Well* sched_well : args.schedule_wells )
+        if (sched_well->getProductionProperties().predictionMode)
+            sum += sched_well->getProductionProperties().ResVRate.getSI();
 
     return { sum, measure::rate };
 }
@@ -673,15 +676,15 @@ template < rt phase, bool outputProducer = true, bool outputInjector = true>
 inline quantity potential_rate( const fn_args& args ) {
     double sum = 0.0;
 
-    for( const auto& sched_well : args.schedule_wells ) {
-        const auto& name = sched_well.name();
+    for( const auto* sched_well : args.schedule_wells ) {
+        const auto& name = sched_well->name();
         if( args.wells.count( name ) == 0 ) continue;
 
-        if (sched_well.isInjector() && outputInjector) {
+        if (sched_well->isInjector() && outputInjector) {
 	    const auto v = args.wells.at(name).rates.get(phase, 0.0);
 	    sum += v;
 	}
-	else if (sched_well.isProducer() && outputProducer) {
+	else if (sched_well->isProducer() && outputProducer) {
 	    const auto v = args.wells.at(name).rates.get(phase, 0.0);
 	    sum += v;
 	}
@@ -1114,10 +1117,11 @@ static const std::unordered_map< std::string, Opm::UnitSystem::measure> block_un
   {"BOVIS"      , Opm::UnitSystem::measure::viscosity},
 };
 
-inline std::vector<Opm::Well> find_wells( const Opm::Schedule& schedule,
-                                           const Opm::SummaryNode& node,
-                                           const int sim_step,
-                                           const Opm::out::RegionCache& regionCache ) {
+inline std::vector<const Opm::Well*>
+find_wells( const Opm::Schedule& schedule,
+            const Opm::SummaryNode& node,
+            const int sim_step,
+            const Opm::out::RegionCache& regionCache ) {
 
     const auto cat = node.category();
 
@@ -1129,7 +1133,7 @@ inline std::vector<Opm::Well> find_wells( const Opm::Schedule& schedule,
 
         if (schedule.hasWell(name, sim_step)) {
             const auto& well = schedule.getWell( name, sim_step );
-            return { well };
+            return { std::addressof(well) };
         } else
             return {};
     }
@@ -1139,26 +1143,23 @@ inline std::vector<Opm::Well> find_wells( const Opm::Schedule& schedule,
 
         if( !schedule.hasGroup( name ) ) return {};
 
-        return schedule.getChildWells2( name, sim_step);
+        return schedule.getChildWellPtrs( name, sim_step);
     }
 
     if( cat == Opm::SummaryNode::Category::Field )
-        return schedule.getWells(sim_step);
+        return schedule.getWellPtrs(sim_step);
 
     if( cat == Opm::SummaryNode::Category::Region ) {
-        std::vector<Opm::Well> wells;
+        std::vector<const Opm::Well*> wells;
 
         const auto region = node.number();
 
         for ( const auto& connection : regionCache.connections( region ) ){
             const auto& w_name = connection.first;
             if (schedule.hasWell(w_name, sim_step)) {
-                const auto& well = schedule.getWell( w_name, sim_step );
+                const auto* well = std::addressof(schedule.getWell( w_name, sim_step ));
 
-                const auto& it = std::find_if( wells.begin(), wells.end(),
-                                               [&] ( const Opm::Well& elem )
-                                               { return elem.name() == well.name(); });
-                if ( it == wells.end() )
+                if ( std::find( wells.begin(), wells.end(), well ) == wells.end() )
                     wells.push_back( well );
             }
         }
@@ -1169,6 +1170,59 @@ inline std::vector<Opm::Well> find_wells( const Opm::Schedule& schedule,
     return {};
 }
 
+/*
+ * Well sets resolved for the summary nodes of a single evaluation.  Nodes
+ * referring to the same entity--e.g., all field level vectors or all
+ * connection vectors of a single well--share one well set which is looked
+ * up in the Schedule at most once.  The cached pointers refer to Well
+ * objects owned by the Schedule so the cache must not outlive the
+ * evaluation in which it was populated.
+ */
+class WellSetCache
+{
+public:
+    const std::vector<const Opm::Well*>&
+    wells(const Opm::Schedule&         schedule,
+          const Opm::SummaryNode&      node,
+          const int                    sim_step,
+          const Opm::out::RegionCache& regionCache)
+    {
+        const auto key = makeKey(node);
+
+        auto pos = this->wells_.find(key);
+        if (pos == this->wells_.end())
+            pos = this->wells_.emplace(key, find_wells(schedule, node, sim_step, regionCache)).first;
+
+        return pos->second;
+    }
+
+private:
+    using Key = std::tuple<Opm::SummaryNode::Category, std::string, int>;
+
+    std::map<Key, std::vector<const Opm::Well*>> wells_{};
+
+    static Key makeKey(const Opm::SummaryNode& node)
+    {
+        using Cat = Opm::SummaryNode::Category;
+
+        switch (node.category()) {
+        case Cat::Well:
+        case Cat::Connection:
+        case Cat::Segment:
+            return Key { Cat::Well, node.namedEntity(), 0 };
+
+        case Cat::Group:
+            return Key { Cat::Group, node.namedEntity(), 0 };
+
+        case Cat::Region:
+            return Key { Cat::Region, "", node.number() };
+
+        default:
+            return Key { node.category(), "", 0 };
+        }
+    }
+};
+
 
 bool need_wells(Opm::SummaryNode::Category cat, const std::string& keyword) {
     static const std::set<std::string> region_keywords{"ROIR", "RGIR", "RWIR", "ROPR", "RGPR", "RWPR", "ROIT", "RWIT", "RGIT", "ROPT", "RGPT", "RWPT"};
@@ -1259,16 +1313,16 @@ void eval_udq(const Opm::Schedule& schedule, std::size_t sim_step, Opm::SummaryS
     }
 }
 
-void updateValue(const Opm::SummaryNode& node, const double value, Opm::SummaryState& st)
+std::size_t nodeSlot(const Opm::SummaryNode& node, Opm::SummaryState& st)
 {
     if (node.category() == Opm::SummaryNode::Category::Well)
-        st.update_well_var(node.namedEntity(), node.keyword(), value);
+        return st.well_slot(node.namedEntity(), node.keyword());
 
     else if (node.category() == Opm::SummaryNode::Category::Group)
-        st.update_group_var(node.namedEntity(), node.keyword(), value);
+        return st.group_slot(node.namedEntity(), node.keyword());
 
     else
-        st.update(node.uniqueNodeKey(), value);
+        return st.slot(node.uniqueNodeKey());
 }
 
 /*
@@ -1296,13 +1350,13 @@ struct EfficiencyFactor
 
     void setFactors(const Opm::SummaryNode&        node,
                     const Opm::Schedule&           schedule,
-                    const std::vector<Opm::Well>& schedule_wells,
+                    const std::vector<const Opm::Well*>& schedule_wells,
                     const int                      sim_step);
 };
 
 void EfficiencyFactor::setFactors(const Opm::SummaryNode&        node,
                                   const Opm::Schedule&           schedule,
-                                  const std::vector<Opm::Well>& schedule_wells,
+                                  const std::vector<const Opm::Well*>& schedule_wells,
                                   const int                      sim_step)
 {
     this->factors.clear();
@@ -1319,7 +1373,8 @@ void EfficiencyFactor::setFactors(const Opm::SummaryNode&        node,
     const bool is_group = (cat == Opm::SummaryNode::Category::Group);
     const bool is_rate = (node.type() != Opm::SummaryNode::Type::Total);
 
-    for( const auto& well : schedule_wells ) {
+    for( const auto* well_ptr : schedule_wells ) {
+        const auto& well = *well_ptr;
         if (!well.hasBeenDefined(sim_step))
             continue;
 
@@ -1349,6 +1404,7 @@ namespace Evaluator {
         const Opm::Schedule& sched;
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
+        WellSetCache& wellSets;
     };
 
     struct SimulatorResults
@@ -1364,11 +1420,20 @@ namespace Evaluator {
     public:
         virtual ~Base() {}
 
-        virtual void update(const std::size_t       sim_step,
-                            const double            stepSize,
-                            const InputData&        input,
-                            const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+        // Register the value computed by this evaluator in 'st' and
+        // return its slot.
+        virtual std::size_t slot(Opm::SummaryState& st) const = 0;
+
+        // Compute this evaluator's value into 'value'.  Returns false if
+        // there is nothing to store at this time, e.g., if the well is
+        // not yet active.  Must not modify shared state since evaluators
+        // may run concurrently.
+        virtual bool evaluate(const std::size_t        sim_step,
+                              const double             stepSize,
+                              const InputData&         input,
+                              const SimulatorResults&  simRes,
+                              const Opm::SummaryState& st,
+                              double&                  value) const = 0;
     };
 
     class FunctionRelation : public Base
@@ -1379,24 +1444,32 @@ namespace Evaluator {
             , fcn_ (std::move(fcn))
         {}
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return nodeSlot(this->node_, st);
+        }
+
+        bool evaluate(const std::size_t        sim_step,
+                      const double             stepSize,
+                      const InputData&         input,
+                      const SimulatorResults&  simRes,
+                      const Opm::SummaryState& st,
+                      double&                  value) const override
         {
             const auto get_wells =
                 need_wells(this->node_.category(), this->node_.keyword());
 
-            const auto wells = get_wells
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<Opm::Well>{};
+            static const auto no_wells = std::vector<const Opm::Well*>{};
+
+            const auto& wells = get_wells
+                ? input.wellSets.wells(input.sched, this->node_,
+                                       static_cast<int>(sim_step), input.reg)
+                : no_wells;
 
             if (get_wells && wells.empty())
                 // Parameter depends on well information, but no active
                 // wells apply at this sim_step.  Nothing to do.
-                return;
+                return false;
 
             EfficiencyFactor efac{};
             efac.setFactors(this->node_, input.sched, wells, sim_step);
@@ -1411,7 +1484,8 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            value = usys.from_si(prm.unit, prm.value);
+            return true;
         }
 
     private:
@@ -1428,19 +1502,26 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return nodeSlot(this->node_, st);
+        }
+
+        bool evaluate(const std::size_t        /* sim_step */,
+                      const double             /* stepSize */,
+                      const InputData&            input,
+                      const SimulatorResults&     simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                     value) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return false;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            value = usys.from_si(this->m_, xPos->second);
+            return true;
         }
 
     private:
@@ -1462,27 +1543,34 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return nodeSlot(this->node_, st);
+        }
+
+        bool evaluate(const std::size_t        /* sim_step */,
+                      const double             /* stepSize */,
+                      const InputData&            input,
+                      const SimulatorResults&     simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                     value) const override
         {
             if (this->node_.number() < 0)
-                return;
+                return false;
 
             auto xPos = simRes.region.find(this->node_.keyword());
             if (xPos == simRes.region.end())
-                return;
+                return false;
 
             const auto ix = this->index();
             if (ix >= xPos->second.size())
-                return;
+                return false;
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            value = usys.from_si(this->m_, val);
+            return true;
         }
 
     private:
@@ -1504,20 +1592,27 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return nodeSlot(this->node_, st);
+        }
+
+        bool evaluate(const std::size_t        /* sim_step */,
+                      const double             /* stepSize */,
+                      const InputData&            input,
+                      const SimulatorResults&     simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                     value) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword());
             if (xPos == simRes.single.end())
-                return;
+                return false;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            value = usys.from_si(this->m_, val);
+            return true;
         }
 
     private:
@@ -1528,14 +1623,28 @@ namespace Evaluator {
     class UserDefinedValue : public Base
     {
     public:
-        void update(const std::size_t       /* sim_step */,
-                    const double            /* stepSize */,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+        explicit UserDefinedValue(Opm::SummaryNode node)
+            : node_(std::move(node))
+        {}
+
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return nodeSlot(this->node_, st);
+        }
+
+        bool evaluate(const std::size_t        /* sim_step */,
+                      const double             /* stepSize */,
+                      const InputData&         /* input */,
+                      const SimulatorResults&  /* simRes */,
+                      const Opm::SummaryState& /* st */,
+                      double&                  /* value */) const override
         {
-            // No-op
+            // No-op.  Value computed in eval_udq().
+            return false;
         }
+
+    private:
+        Opm::SummaryNode node_;
     };
 
     class Time : public Base
@@ -1545,18 +1654,25 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return st.slot(this->saveKey_);
+        }
+
+        bool evaluate(const std::size_t       /* sim_step */,
+                      const double               stepSize,
+                      const InputData&           input,
+                      const SimulatorResults& /* simRes */,
+                      const Opm::SummaryState&   st,
+                      double&                    value) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
+            value = usys.from_si(m, val);
+            return true;
         }
 
     private:
@@ -1570,17 +1686,24 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        std::size_t slot(Opm::SummaryState& st) const override
+        {
+            return st.slot(this->saveKey_);
+        }
+
+        bool evaluate(const std::size_t       /* sim_step */,
+                      const double               stepSize,
+                      const InputData&        /* input */,
+                      const SimulatorResults& /* simRes */,
+                      const Opm::SummaryState&   st,
+                      double&                    value) const override
         {
             using namespace ::Opm::unit;
 
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, year));
+            value = convert::to(val, year);
+            return true;
         }
 
     private:
@@ -1717,7 +1840,7 @@ namespace Evaluator {
         auto desc = this->unknownParameter();
 
         desc.unit = this->userDefinedUnit();
-        desc.evaluator.reset(new UserDefinedValue {});
+        desc.evaluator.reset(new UserDefinedValue { *this->node_ });
 
         return desc;
     }
@@ -2016,6 +2139,8 @@ public:
     void internal_store(const SummaryState& st, const int report_step);
     void write();
 
+    void setEvalThreads(const int numThreads);
+
 private:
     struct MiniStep
     {
@@ -2026,6 +2151,21 @@ private:
 
     using EvalPtr = SummaryOutputParameters::EvalPtr;
 
+    // Evaluators and parameter values resolved to integer slots in a
+    // particular SummaryState slot layout.  Evaluator 'i' stores its result
+    // in slot evalSlots[i] and the value of output parameter 'i' is read
+    // from slot valueSlots[i].  The 'values' and 'hasValue' arrays hold
+    // the evaluators' results before they are merged into the state.
+    struct EvaluationPlan
+    {
+        std::size_t layout{0};
+        std::vector<const Evaluator::Base*> evaluators{};
+        std::vector<std::size_t> evalSlots{};
+        std::vector<std::size_t> valueSlots{};
+        std::vector<double> values{};
+        std::vector<char> hasValue{};
+    };
+
     std::reference_wrapper<const Opm::EclipseGrid> grid_;
     Opm::out::RegionCache regCache_;
 
@@ -2034,6 +2174,7 @@ private:
     Opm::EclIO::OutputStream::ResultSet rset_;
     Opm::EclIO::OutputStream::Formatted fmt_;
     Opm::EclIO::OutputStream::Unified   unif_;
+    bool columnar_{false};
 
     int miniStepID_{0};
     int prevCreate_{-1};
@@ -2044,9 +2185,12 @@ private:
     std::vector<EvalPtr>     requiredRestartParameters_{};
     std::vector<std::string> valueKeys_{};
     std::vector<MiniStep>    unwritten_{};
+    mutable EvaluationPlan   plan_{};
+    int                      numThreads_{1};
 
     std::unique_ptr<Opm::EclIO::OutputStream::SummarySpecification> smspec_{};
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
+    std::unique_ptr<Opm::EclIO::OutputStream::SummaryColumns> columns_{};
 
     void configureTimeVectors(const EclipseState& es);
 
@@ -2065,6 +2209,9 @@ private:
 
     void createSMSpecIfNecessary();
     void createSmryStreamIfNecessary(const int report_step);
+    void createColumnStreamIfNecessary();
+
+    void compilePlan(SummaryState& st) const;
 };
 
 Opm::out::Summary::SummaryImplementation::
@@ -2083,6 +2230,7 @@ SummaryImplementation(const EclipseState&  es,
     , rset_          (makeResultSet(es.cfg().io(), basename))
     , fmt_           { es.cfg().io().getFMTOUT() }
     , unif_          { es.cfg().io().getUNIFOUT() }
+    , columnar_      (es.cfg().io().getColumnarSummary())
 {
     this->configureTimeVectors(es);
     this->configureSummaryInput(es, sumcfg, grid, sched);
@@ -2096,6 +2244,16 @@ internal_store(const SummaryState& st, const int report_step)
 
     const auto nParam = this->valueKeys_.size();
 
+    if (st.layout_id() == this->plan_.layout) {
+        for (auto i = decltype(nParam){0}; i < nParam; ++i) {
+            const auto slot = this->plan_.valueSlots[i];
+            if (st.has_slot(slot))
+                ms.params[i] = st.get_slot(slot);
+        }
+
+        return;
+    }
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
         if (! st.has(this->valueKeys_[i]))
             // Parameter not yet evaluated (e.g., well/group not
@@ -2118,23 +2276,97 @@ eval(const EclipseState&            es,
      const BlockValues&             block_values,
      Opm::SummaryState&             st) const
 {
-    const Evaluator::InputData input {
-        es, sched, this->grid_, this->regCache_
-    };
+    if (st.layout_id() != this->plan_.layout)
+        this->compilePlan(st);
 
     const Evaluator::SimulatorResults simRes {
         well_solution, single_values, region_values, block_values
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    auto& plan = this->plan_;
+    const auto numEval = static_cast<long>(plan.evaluators.size());
+
+    // Evaluators only read from 'st' and write to their own element of
+    // 'values' so they are run independently, with each thread using its
+    // own well set cache.  Results are merged into 'st' afterwards.
+    auto failure = std::exception_ptr{};
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(this->numThreads_) if (this->numThreads_ > 1)
+#endif
+    {
+        WellSetCache wellSets{};
+
+        const Evaluator::InputData input {
+            es, sched, this->grid_, this->regCache_, wellSets
+        };
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (long i = 0; i < numEval; ++i) {
+            try {
+                plan.hasValue[i] = plan.evaluators[i]->
+                    evaluate(sim_step, duration, input, simRes, st, plan.values[i]);
+            }
+            catch (...) {
+                plan.hasValue[i] = false;
+
+#ifdef _OPENMP
+#pragma omp critical(summary_eval_failure)
+#endif
+                if (! failure)
+                    failure = std::current_exception();
+            }
+        }
     }
 
-    for (auto& evalPtr : this->requiredRestartParameters_) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    if (failure)
+        std::rethrow_exception(failure);
+
+    for (auto i = 0*plan.evaluators.size(); i < plan.evaluators.size(); ++i) {
+        if (plan.hasValue[i])
+            st.update_slot(plan.evalSlots[i], plan.values[i]);
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::
+compilePlan(SummaryState& st) const
+{
+    auto& plan = this->plan_;
+
+    plan.evaluators.clear();
+    plan.evalSlots.clear();
+
+    auto addEvaluator = [&plan, &st](const EvalPtr& evalPtr)
+    {
+        plan.evaluators.push_back(evalPtr.get());
+        plan.evalSlots.push_back(evalPtr->slot(st));
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators())
+        addEvaluator(evalPtr);
+
+    for (const auto& evalPtr : this->requiredRestartParameters_)
+        addEvaluator(evalPtr);
+
+    plan.values.assign(plan.evaluators.size(), 0.0);
+    plan.hasValue.assign(plan.evaluators.size(), false);
+
+    plan.valueSlots.clear();
+    for (const auto& key : this->valueKeys_)
+        plan.valueSlots.push_back(st.slot(key));
+
+    plan.layout = st.layout_id();
+}
+
+void
+Opm::out::Summary::SummaryImplementation::setEvalThreads(const int numThreads)
+{
+    this->numThreads_ = std::max(1, numThreads);
+}
+
 void Opm::out::Summary::SummaryImplementation::write()
 {
     const auto zero = std::vector<MiniStep>::size_type{0};
@@ -2154,6 +2386,17 @@ void Opm::out::Summary::SummaryImplementation::write()
     // Eagerly output last set of parameters to permanent storage.
     this->stream_->flushStream();
 
+    if (this->columnar_) {
+        this->createColumnStreamIfNecessary();
+
+        for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i) {
+            const auto& ms = this->unwritten_[i];
+            this->columns_->add(ms.seq, ms.id, ms.params);
+        }
+
+        this->columns_->write();
+    }
+
     // Reset "unwritten" counter to reflect the fact that we've
     // output all stored ministeps.
     this->numUnwritten_ = zero;
@@ -2347,6 +2590,15 @@ createSmryStreamIfNecessary(const int report_step)
     }
 }
 
+void
+Opm::out::Summary::SummaryImplementation::createColumnStreamIfNecessary()
+{
+    if (! this->columns_) {
+        this->columns_ = std::make_unique<Opm::EclIO::OutputStream::SummaryColumns>
+            (this->rset_, this->fmt_, static_cast<int>(this->valueKeys_.size()));
+    }
+}
+
 namespace {
 
 void validateElapsedTime(const double             secs_elapsed,
@@ -2421,6 +2673,11 @@ void Summary::write() const
     this->pImpl_->write();
 }
 
+void Summary::set_eval_threads(const int num_threads)
+{
+    this->pImpl_->setEvalThreads(num_threads);
+}
+
 Summary::~Summary() {}
 
 }} // namespace Opm::out
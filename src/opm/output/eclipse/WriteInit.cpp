@@ -231,9 +231,16 @@ namespace {
 
     // =================================================================
 
-    std::vector<float> singlePrecision(const std::vector<double>& x)
+    void writeSinglePrecision(const std::string&                kw,
+                              const std::vector<double>&        x,
+                              ::Opm::EclIO::OutputStream::Init& initFile)
     {
-        return { x.begin(), x.end() };
+        // Convert to single precision one block at a time rather than
+        // through a full copy of the input array.
+        initFile.write(kw, x.size(), [&x](const std::size_t i)
+        {
+            return static_cast<float>(x[i]);
+        });
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -321,7 +328,7 @@ namespace {
     {
         auto porv = es.fieldProps().porv(true);
         units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        writeSinglePrecision("PORV", porv, initFile);
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
@@ -361,7 +368,7 @@ namespace {
             }
         }
         units.from_si(::Opm::UnitSystem::measure::volume, porv);
-        initFile.write("PORV", singlePrecision(porv));
+        writeSinglePrecision("PORV", porv, initFile);
      }
 
 
@@ -400,25 +407,25 @@ namespace {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
-
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
-            const auto  globCell = grid.getGlobalIndex(cell);
-            const auto& dims     = grid.getCellDims(globCell);
+        // Values are computed per active cell while writing, in output
+        // units, so no per-cell copies of the geometry are created.
+        initFile.write("DEPTH", nAct, [&grid, &units, length](const std::size_t cell)
+        {
+            return static_cast<float>(units.from_si(length, grid.getCellDepth(grid.getGlobalIndex(cell))));
+        });
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
-        }
+        const auto writeDim = [&grid, &units, &initFile, length, nAct]
+            (const std::string& kw, const std::size_t dim)
+        {
+            initFile.write(kw, nAct, [&grid, &units, length, dim](const std::size_t cell)
+            {
+                return static_cast<float>(units.from_si(length, grid.getCellDims(grid.getGlobalIndex(cell))[dim]));
+            });
+        };
 
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        writeDim("DX", 0);
+        writeDim("DY", 1);
+        writeDim("DZ", 2);
     }
 
     template <typename T, class WriteVector>
@@ -508,12 +515,12 @@ namespace {
                         // (-1.0e+20) to signify defaulted element.
                         //
                         // Note: Start as float for roundtripping through
-                        // function singlePrecision().
+                        // function writeSinglePrecision().
                         value[i] = static_cast<double>(-1.0e+20f);
                     }
                 }
 
-                initFile.write(prop.name, singlePrecision(value));
+                writeSinglePrecision(prop.name, value, initFile);
             });
         }
         else {
@@ -522,7 +529,7 @@ namespace {
                                     std::vector<double>&& value)
             {
                 units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
+                writeSinglePrecision(prop.name, value, initFile);
             });
         }
     }
@@ -561,7 +568,7 @@ namespace {
         for (const auto& prop : simProps) {
             const auto& value = grid.compressedVector(prop.second.data);
 
-            initFile.write(prop.first, singlePrecision(value));
+            writeSinglePrecision(prop.first, value, initFile);
         }
     }
 
@@ -681,7 +688,7 @@ namespace {
 
         units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
 
-        initFile.write("TRANNNC", singlePrecision(tran));
+        writeSinglePrecision("TRANNNC", tran, initFile);
     }
 } // Anonymous namespace
 
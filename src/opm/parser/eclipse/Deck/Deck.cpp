@@ -170,7 +170,8 @@ namespace Opm {
         keywordList( d.keywordList ),
         defaultUnits( d.defaultUnits ),
         m_dataFile( d.m_dataFile ),
-        input_path( d.input_path )
+        input_path( d.input_path ),
+        input_files( d.input_files )
     {
         this->init(this->keywordList.begin(), this->keywordList.end());
         if (d.activeUnits)
@@ -280,6 +281,14 @@ namespace Opm {
             this->input_path = dataFile.substr(0, slash_pos);
     }
 
+    const std::vector<std::string>& Deck::getInputFiles() const {
+        return this->input_files;
+    }
+
+    void Deck::addInputFile(const std::string& filename) {
+        this->input_files.push_back( filename );
+    }
+
     Deck::iterator Deck::begin() {
         return this->keywordList.begin();
     }
@@ -304,6 +313,7 @@ namespace Opm {
         defaultUnits = data.defaultUnits;
         m_dataFile = data.m_dataFile;
         input_path = data.input_path;
+        input_files = data.input_files;
         unit_system_access_count = data.unit_system_access_count;
         this->init(this->keywordList.begin(), this->keywordList.end());
         activeUnits.reset();
@@ -0,0 +1,464 @@
+/*
+  Copyright 2020 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
+#include <opm/parser/eclipse/Deck/DeckItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/Deck/UDAValue.hpp>
+#include <opm/parser/eclipse/Units/Dimension.hpp>
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+/*
+  Layout of the cache file; all values are written in native byte order,
+  strings and vectors are prefixed with their length as a uint64:
+
+     "OPMDECK\0" format_version
+     files:    count { filename hash }
+     deck:     data_file input_path input_files access_count default_units
+               has_active_units [active_units]
+     keywords: count { name filename lineno flags
+                       records: count { items: count { item } } }
+
+  The numeric arrays of the items are stored as contiguous blocks, and are
+  copied straight from the file buffer when loading. The value status of
+  an item is stored as the run length encoded { status end } pairs. The file hashes are
+  64 bit FNV-1a hashes of the file content.
+*/
+
+namespace Opm {
+namespace DeckCache {
+
+namespace {
+
+    const char magic[8] = {'O', 'P', 'M', 'D', 'E', 'C', 'K', '\0'};
+
+    enum keyword_flags : std::uint8_t {
+        data_keyword = 1,
+        slash_terminated = 2,
+        double_record = 4
+    };
+
+    /* Smallest possible size of a stored DeckKeyword. */
+    const std::size_t keyword_size = 4 * sizeof(std::uint64_t) + 1;
+
+
+    bool read_file(const std::string& filename, std::vector<char>& buffer) {
+        const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+        std::unique_ptr< std::FILE, decltype( closer ) > ufp( std::fopen( filename.c_str(), "rb" ), closer );
+        if (!ufp)
+            return false;
+
+        auto* fp = ufp.get();
+        std::fseek( fp, 0, SEEK_END );
+        long size = std::ftell( fp );
+        if (size < 0)
+            return false;
+
+        buffer.resize( size );
+        std::rewind( fp );
+        return std::fread( buffer.data(), 1, buffer.size(), fp ) == buffer.size();
+    }
+
+
+    bool file_hash(const std::string& filename, std::uint64_t& hash) {
+        std::vector<char> content;
+        if (!read_file(filename, content))
+            return false;
+
+        hash = 14695981039346656037ULL;
+        for (const auto c : content) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return true;
+    }
+
+
+
+    class Writer {
+    public:
+        explicit Writer(const std::string& filename) :
+            stream(filename, std::ios::binary)
+        {
+            if (!this->stream)
+                throw std::runtime_error("Could not open deck cache file: " + filename + " for writing");
+        }
+
+        template <typename T>
+        void value(const T& v) {
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly");
+            this->stream.write( reinterpret_cast<const char*>(&v), sizeof v );
+        }
+
+        void string(const std::string& s) {
+            this->value<std::uint64_t>( s.size() );
+            this->stream.write( s.data(), s.size() );
+        }
+
+        template <typename T>
+        void array(const std::vector<T>& data) {
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written as arrays");
+            this->value<std::uint64_t>( data.size() );
+            this->stream.write( reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T) );
+        }
+
+        void dimension(const Dimension& dim) {
+            this->string( dim.getName() );
+            this->value( dim.getSIScalingRaw() );
+            this->value( dim.getSIOffset() );
+        }
+
+        void dimensions(const std::vector<Dimension>& dims) {
+            this->value<std::uint64_t>( dims.size() );
+            for (const auto& dim : dims)
+                this->dimension( dim );
+        }
+
+        void status_runs(const std::vector<value::status_run>& runs) {
+            this->value<std::uint64_t>( runs.size() );
+            for (const auto& run : runs) {
+                this->value<std::uint8_t>( static_cast<std::uint8_t>(run.value_status) );
+                this->value<std::uint64_t>( run.end );
+            }
+        }
+
+        void unit_system(const UnitSystem& units) {
+            this->string( units.getName() );
+            this->value<std::int32_t>( static_cast<std::int32_t>(units.getType()) );
+            this->value<std::uint64_t>( units.use_count() );
+            this->value<std::uint64_t>( units.getDimensions().size() );
+            for (const auto& dim_pair : units.getDimensions()) {
+                this->string( dim_pair.first );
+                this->dimension( dim_pair.second );
+            }
+        }
+
+        void item(const DeckItem& item) {
+            this->string( item.name() );
+            this->value<std::uint8_t>( static_cast<std::uint8_t>(item.getType()) );
+            this->value<std::uint8_t>( item.rawData() );
+            this->status_runs( item.getValueStatusRuns() );
+            this->dimensions( item.activeDimensions() );
+            this->dimensions( item.defaultDimensions() );
+
+            this->array( item.dVal() );
+            this->array( item.iVal() );
+
+            this->value<std::uint64_t>( item.sVal().size() );
+            for (const auto& s : item.sVal())
+                this->string( s );
+
+            this->value<std::uint64_t>( item.uVal().size() );
+            for (const auto& uda : item.uVal()) {
+                this->value<std::uint8_t>( uda.is<double>() );
+                if (uda.is<double>())
+                    this->value( uda.get<double>() );
+                else
+                    this->string( uda.get<std::string>() );
+                this->dimension( uda.get_dim() );
+            }
+        }
+
+        void keyword(const DeckKeyword& keyword) {
+            std::uint8_t flags = 0;
+            if (keyword.isDataKeyword())
+                flags |= data_keyword;
+            if (keyword.isSlashTerminated())
+                flags |= slash_terminated;
+            if (keyword.isDoubleRecordKeyword())
+                flags |= double_record;
+
+            this->string( keyword.name() );
+            this->string( keyword.location().filename );
+            this->value<std::uint64_t>( keyword.location().lineno );
+            this->value( flags );
+
+            this->value<std::uint64_t>( keyword.size() );
+            for (const auto& record : keyword) {
+                this->value<std::uint64_t>( record.size() );
+                for (const auto& item : record)
+                    this->item( item );
+            }
+        }
+
+        void bytes(const char * data, std::size_t size) {
+            this->stream.write(data, size);
+        }
+
+        bool good() const {
+            return this->stream.good();
+        }
+
+    private:
+        std::ofstream stream;
+    };
+
+
+
+    class Reader {
+    public:
+        explicit Reader(std::vector<char>&& buffer_arg) :
+            buffer(std::move(buffer_arg))
+        {}
+
+        const char * bytes(std::size_t size) {
+            if (size > this->buffer.size() - this->offset)
+                throw std::runtime_error("Deck cache file is truncated");
+
+            const char * data = this->buffer.data() + this->offset;
+            this->offset += size;
+            return data;
+        }
+
+        template <typename T>
+        T value() {
+            T v;
+            std::memcpy( &v, this->bytes(sizeof v), sizeof v );
+            return v;
+        }
+
+        /*
+          Reads the number of elements in a sequence where every element
+          occupies at least min_size bytes in the file; a count which can
+          not fit in the remaining part of the buffer is rejected before it
+          is used to allocate anything.
+        */
+        std::size_t count(std::size_t min_size) {
+            auto size = this->value<std::uint64_t>();
+            if (size > (this->buffer.size() - this->offset) / min_size)
+                throw std::runtime_error("Deck cache file is truncated");
+
+            return size;
+        }
+
+        std::string string() {
+            auto size = this->count(1);
+            return std::string( this->bytes(size), size );
+        }
+
+        template <typename T>
+        std::vector<T> array() {
+            auto size = this->count(sizeof(T));
+            std::vector<T> data(size);
+            std::memcpy( data.data(), this->bytes(size * sizeof(T)), size * sizeof(T) );
+            return data;
+        }
+
+        Dimension dimension() {
+            auto name = this->string();
+            auto factor = this->value<double>();
+            auto si_offset = this->value<double>();
+            return Dimension::newComposite(name, factor, si_offset);
+        }
+
+        std::vector<Dimension> dimensions() {
+            std::vector<Dimension> dims( this->count(dimension_size) );
+            for (auto& dim : dims)
+                dim = this->dimension();
+            return dims;
+        }
+
+        std::vector<value::status_run> status_runs() {
+            std::vector<value::status_run> runs( this->count(status_run_size) );
+            std::size_t begin = 0;
+            for (auto& run : runs) {
+                run.value_status = static_cast<value::status>( this->value<std::uint8_t>() );
+                run.end = this->value<std::uint64_t>();
+                if (run.end <= begin)
+                    throw std::runtime_error("Deck cache file is corrupt");
+
+                begin = run.end;
+            }
+            return runs;
+        }
+
+        UnitSystem unit_system() {
+            auto name = this->string();
+            auto type = static_cast<UnitSystem::UnitType>( this->value<std::int32_t>() );
+            auto use_count = this->value<std::uint64_t>();
+            std::map<std::string, Dimension> dims;
+            auto num_dims = this->count(dimension_size);
+            for (std::uint64_t index = 0; index < num_dims; index++) {
+                auto dim_name = this->string();
+                dims.emplace( dim_name, this->dimension() );
+            }
+            return UnitSystem(name, type, dims, use_count);
+        }
+
+        DeckItem item() {
+            auto name = this->string();
+            auto type = static_cast<type_tag>( this->value<std::uint8_t>() );
+            bool raw_data = this->value<std::uint8_t>();
+            auto value_status = this->status_runs();
+            auto active_dims = this->dimensions();
+            auto default_dims = this->dimensions();
+
+            auto dval = this->array<double>();
+            auto ival = this->array<int>();
+
+            std::vector<std::string> sval( this->count(sizeof(std::uint64_t)) );
+            for (auto& s : sval)
+                s = this->string();
+
+            std::vector<UDAValue> uval;
+            auto num_uda = this->count(1 + sizeof(std::uint64_t) + dimension_size);
+            uval.reserve(num_uda);
+            for (std::uint64_t index = 0; index < num_uda; index++) {
+                bool numeric = this->value<std::uint8_t>();
+                UDAValue uda = numeric ? UDAValue( this->value<double>() ) : UDAValue( this->string() );
+                uval.emplace_back( uda, this->dimension() );
+            }
+
+            return DeckItem(dval, ival, sval, uval, type, name, value_status, raw_data, active_dims, default_dims);
+        }
+
+        DeckKeyword keyword() {
+            auto name = this->string();
+            auto filename = this->string();
+            auto lineno = this->value<std::uint64_t>();
+            auto flags = this->value<std::uint8_t>();
+
+            std::vector<DeckRecord> records( this->count(sizeof(std::uint64_t)) );
+            for (auto& record : records) {
+                std::vector<DeckItem> items( this->count(item_size) );
+                for (auto& item : items)
+                    item = this->item();
+                record = DeckRecord( std::move(items) );
+            }
+
+            DeckKeyword keyword(name, Location(filename, lineno), records, flags & data_keyword, flags & slash_terminated);
+            keyword.setDoubleRecordKeyword( flags & double_record );
+            return keyword;
+        }
+
+    private:
+        /* Smallest possible size of a stored status run, Dimension and DeckItem. */
+        static constexpr std::size_t status_run_size = 1 + sizeof(std::uint64_t);
+        static constexpr std::size_t dimension_size = sizeof(std::uint64_t) + 2 * sizeof(double);
+        static constexpr std::size_t item_size = 8 * sizeof(std::uint64_t) + 2;
+
+        std::vector<char> buffer;
+        std::size_t offset = 0;
+    };
+
+}
+
+
+void save(const Deck& deck, const std::string& cache_file) {
+    Writer writer(cache_file);
+
+    writer.bytes( magic, sizeof magic );
+    writer.value( format_version );
+
+    const auto& opened_files = deck.getInputFiles();
+    const std::set<std::string> files(opened_files.begin(), opened_files.end());
+    writer.value<std::uint64_t>( files.size() );
+    for (const auto& filename : files) {
+        std::uint64_t hash;
+        if (!file_hash(filename, hash))
+            throw std::runtime_error("Could not read input file: " + filename);
+
+        writer.string( filename );
+        writer.value( hash );
+    }
+
+    writer.string( deck.getDataFile() );
+    writer.string( deck.getInputPath() );
+    writer.value<std::uint64_t>( opened_files.size() );
+    for (const auto& filename : opened_files)
+        writer.string( filename );
+    writer.value<std::uint64_t>( deck.unitSystemAccessCount() );
+    writer.unit_system( deck.getDefaultUnitSystem() );
+
+    const auto& active_units = deck.activeUnitSystem();
+    writer.value<std::uint8_t>( static_cast<bool>(active_units) );
+    if (active_units)
+        writer.unit_system( *active_units );
+
+    writer.value<std::uint64_t>( deck.size() );
+    for (const auto& keyword : deck)
+        writer.keyword( keyword );
+
+    if (!writer.good())
+        throw std::runtime_error("Writing deck cache file: " + cache_file + " failed");
+}
+
+
+bool load(const std::string& cache_file, Deck& deck) {
+    std::vector<char> buffer;
+    if (!read_file(cache_file, buffer))
+        return false;
+
+    Reader reader(std::move(buffer));
+    try {
+        if (std::memcmp( reader.bytes(sizeof magic), magic, sizeof magic ) != 0)
+            return false;
+
+        if (reader.value<std::uint32_t>() != format_version)
+            return false;
+
+        auto num_files = reader.count(2 * sizeof(std::uint64_t));
+        for (std::uint64_t index = 0; index < num_files; index++) {
+            auto filename = reader.string();
+            auto cached_hash = reader.value<std::uint64_t>();
+            std::uint64_t hash;
+            if (!file_hash(filename, hash) || hash != cached_hash)
+                return false;
+        }
+
+        auto data_file = reader.string();
+        auto input_path = reader.string();
+        std::vector<std::string> opened_files( reader.count(sizeof(std::uint64_t)) );
+        for (auto& filename : opened_files)
+            filename = reader.string();
+        auto access_count = reader.value<std::uint64_t>();
+        auto default_units = reader.unit_system();
+        std::unique_ptr<UnitSystem> active_units;
+        if (reader.value<std::uint8_t>())
+            active_units.reset( new UnitSystem(reader.unit_system()) );
+
+        std::vector<DeckKeyword> keywords( reader.count(keyword_size) );
+        for (auto& keyword : keywords)
+            keyword = reader.keyword();
+
+        deck = Deck(keywords, default_units, active_units.get(), data_file, input_path, access_count);
+        for (const auto& filename : opened_files)
+            deck.addInputFile( filename );
+    } catch (const std::exception&) {
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
@@ -47,11 +47,55 @@ DeckItem::DeckItem(const std::vector<double>& dVec,
     , uval(uVec)
     , type(typ)
     , item_name(itemName)
-    , value_status(valueStat)
     , raw_data(rawdata)
     , active_dimensions(activeDim)
     , default_dimensions(defDim)
-{}
+{
+    for (const auto& st : valueStat)
+        this->push_status( st );
+}
+
+DeckItem::DeckItem(const std::vector<double>& dVec,
+                   const std::vector<int>& iVec,
+                   const std::vector<std::string>& sVec,
+                   const std::vector<UDAValue>& uVec,
+                   type_tag typ,
+                   const std::string& itemName,
+                   const std::vector<value::status_run>& valueStatRuns,
+                   bool rawdata,
+                   const std::vector<Dimension>& activeDim,
+                   const std::vector<Dimension>& defDim)
+    : dval(dVec)
+    , ival(iVec)
+    , sval(sVec)
+    , uval(uVec)
+    , type(typ)
+    , item_name(itemName)
+    , value_status(valueStatRuns)
+    , raw_data(rawdata)
+    , active_dimensions(activeDim)
+    , default_dimensions(defDim)
+{
+}
+
+value::status DeckItem::status( size_t index ) const {
+    if (this->value_status.size() == 1)
+        return this->value_status.front().value_status;
+
+    auto run = std::upper_bound( this->value_status.begin(), this->value_status.end(), index,
+                                 []( size_t i, const value::status_run& r ) { return i < r.end; });
+    return run->value_status;
+}
+
+void DeckItem::push_status( value::status st, size_t n ) {
+    if (n == 0)
+        return;
+
+    if (!this->value_status.empty() && this->value_status.back().value_status == st)
+        this->value_status.back().end += n;
+    else
+        this->value_status.push_back( { st, this->data_size() + n } );
+}
 
 template< typename T >
 std::vector< T >& DeckItem::value_ref() {
@@ -127,31 +171,41 @@ const std::string& DeckItem::name() const {
 }
 
 bool DeckItem::defaultApplied( size_t index ) const {
-    return value::defaulted( this->value_status.at(index));
+    if (index >= this->data_size())
+        throw std::out_of_range("Invalid index");
+
+    return value::defaulted( this->status(index) );
 }
 
-const std::vector<value::status>& DeckItem::getValueStatus() const {
+std::vector<value::status> DeckItem::getValueStatus() const {
+    return this->valueStatus();
+}
+
+const std::vector<value::status_run>& DeckItem::getValueStatusRuns() const {
     return this->value_status;
 }
 
 bool DeckItem::hasValue( size_t index ) const {
-    if (index >= this->value_status.size())
+    if (index >= this->data_size())
         return false;
 
-    return value::has_value( this->value_status[index] );
+    return value::has_value( this->status(index) );
 }
 
 size_t DeckItem::data_size() const {
-    return this->value_status.size();
+    if (this->value_status.empty())
+        return 0;
+
+    return this->value_status.back().end;
 }
 
 
 template< typename T >
 T DeckItem::get( size_t index ) const {
-    if (index >= this->value_status.size())
+    if (index >= this->data_size())
         throw std::out_of_range("Invalid index");
 
-    if (!value::has_value(this->value_status[index]))
+    if (!value::has_value(this->status(index)))
         throw std::invalid_argument("Invalid arguemnt");
 
     return this->value_ref< T >()[index];
@@ -164,7 +218,7 @@ UDAValue DeckItem::get( size_t index ) const {
         return value;
 
     std::size_t dim_index = index % this->active_dimensions.size();
-    if (value::defaulted(this->value_status[index]))
+    if (value::defaulted(this->status(index)))
         return UDAValue( value, this->default_dimensions[dim_index]);
     else
         return UDAValue( value, this->active_dimensions[dim_index]);
@@ -182,7 +236,7 @@ void DeckItem::push( T x ) {
     auto& val = this->value_ref< T >();
 
     val.push_back( std::move( x ) );
-    this->value_status.push_back( value::status::deck_value );
+    this->push_status( value::status::deck_value );
 }
 
 void DeckItem::push_back( int x ) {
@@ -206,7 +260,7 @@ void DeckItem::push( T x, size_t n ) {
     auto& val = this->value_ref< T >();
 
     val.insert( val.end(), n, x );
-    this->value_status.insert( this->value_status.end(), n, value::status::deck_value );
+    this->push_status( value::status::deck_value, n );
 }
 
 void DeckItem::push_back( int x, size_t n ) {
@@ -228,12 +282,12 @@ void DeckItem::push_back( UDAValue x, size_t n ) {
 template< typename T >
 void DeckItem::push_default( T x ) {
     auto& val = this->value_ref< T >();
-    if( this->value_status.size() != val.size() )
+    if( this->data_size() != val.size() )
         throw std::logic_error("To add a value to an item, "
                 "no 'pseudo defaults' can be added before");
 
     val.push_back( std::move( x ) );
-    this->value_status.push_back( value::status::valid_default );
+    this->push_status( value::status::valid_default );
 }
 
 void DeckItem::push_backDefault( int x ) {
@@ -257,7 +311,7 @@ template<typename T>
 void DeckItem::push_backDummyDefault() {
     auto& val = this->value_ref< T >();
     val.push_back( T() );
-    this->value_status.push_back( value::status::empty_default );
+    this->push_status( value::status::empty_default );
 }
 
 std::string DeckItem::getTrimmedString( size_t index ) const {
@@ -277,15 +331,11 @@ const std::vector<double>& DeckItem::getData() const {
         return data;
 
     const auto dim_size = this->active_dimensions.size();
-    for( size_t index = 0; index < data.size(); index++ ) {
-        const auto dimIndex = index % dim_size;
-        if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        } else {
-            const auto& dim = this->active_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        }
+    size_t index = 0;
+    for (const auto& run : this->value_status) {
+        const auto& dims = value::defaulted(run.value_status) ? this->default_dimensions : this->active_dimensions;
+        for (; index < run.end; index++)
+            data[ index ] = dims[ index % dim_size ].convertSiToRaw( data[ index ] );
     }
     this->raw_data = true;
     return data;
@@ -308,16 +358,11 @@ const std::vector< double >& DeckItem::getSIDoubleData() const {
      */
 
     const auto dim_size = this->active_dimensions.size();
-    const auto sz = data.size();
-    for( size_t index = 0; index < sz; index++ ) {
-        const auto dimIndex = index % dim_size;
-        if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
-            data[ index ] = dim.convertRawToSi( data[ index ] );
-        } else {
-            const auto& dim = this->active_dimensions[dimIndex];
-            data[ index ] = dim.convertRawToSi( data[ index ] );
-        }
+    size_t index = 0;
+    for (const auto& run : this->value_status) {
+        const auto& dims = value::defaulted(run.value_status) ? this->default_dimensions : this->active_dimensions;
+        for (; index < run.end; index++)
+            data[ index ] = dims[ index % dim_size ].convertRawToSi( data[ index ] );
     }
     this->raw_data = false;
     return data;
@@ -399,10 +444,17 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
     if (this->item_name != other.item_name)
         return false;
 
-    if (cmp_default)
-        if (this->value_status != other.value_status)
+    if (cmp_default) {
+        const auto same_run = []( const value::status_run& r1, const value::status_run& r2 ) {
+            return r1.value_status == r2.value_status && r1.end == r2.end;
+        };
+        if (this->value_status.size() != other.value_status.size())
             return false;
 
+        if (!std::equal( this->value_status.begin(), this->value_status.end(), other.value_status.begin(), same_run ))
+            return false;
+    }
+
     switch( this->type ) {
     case type_tag::integer:
         if (this->ival != other.ival)
@@ -500,8 +552,13 @@ const std::vector<UDAValue>& DeckItem::uVal() const {
     return uval;
 }
 
-const std::vector<value::status>& DeckItem::valueStatus() const {
-    return value_status;
+std::vector<value::status> DeckItem::valueStatus() const {
+    std::vector<value::status> status_list;
+    status_list.reserve( this->data_size() );
+    for (const auto& run : this->value_status)
+        status_list.insert( status_list.end(), run.end - status_list.size(), run.value_status );
+
+    return status_list;
 }
 
 bool DeckItem::rawData() const {
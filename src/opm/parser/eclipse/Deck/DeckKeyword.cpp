@@ -280,10 +280,14 @@ namespace Opm {
         return this->getDataRecord().getDataItem().getSIDoubleData();
     }
 
-    const std::vector<value::status>& DeckKeyword::getValueStatus() const {
+    std::vector<value::status> DeckKeyword::getValueStatus() const {
         return this->getDataRecord().getDataItem().getValueStatus();
    }
 
+    const std::vector<value::status_run>& DeckKeyword::getValueStatusRuns() const {
+        return this->getDataRecord().getDataItem().getValueStatusRuns();
+    }
+
     void DeckKeyword::write_data( DeckOutput& output ) const {
         for (const auto& record: *this)
             record.write( output );
@@ -21,6 +21,7 @@
 #include <functional>
 #include <initializer_list>
 #include <set>
+#include <stdexcept>
 #include <string>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
@@ -475,11 +476,23 @@ namespace Opm {
         // supported. (and hopefully never will be)
         // register the grid properties
         m_intGridProperties(eclipseGrid, makeSupportedIntKeywords()),
-        m_doubleGridProperties(eclipseGrid, &unit_system,
+        m_doubleGridProperties(eclipseGrid, &m_deckUnitSystem,
                                makeSupportedDoubleKeywords(&tableManager, &eclipseGrid, &m_intGridProperties))
     {
     }
 
+    Eclipse3DProperties::Eclipse3DProperties(FieldPropsOnly, const FieldPropsManager& fieldProps) :
+        m_defaultRegion("FLUXNUM"),
+        m_fieldPropsOnly(true),
+        m_fieldProps(fieldProps)
+    {
+    }
+
+    void Eclipse3DProperties::assertDeckProperties(const std::string& method) const {
+        if (m_fieldPropsOnly)
+            throw std::logic_error("Eclipse3DProperties::" + method + " is not available when built with ENABLE_FIELDPROPS_ONLY - use EclipseState::fieldProps()");
+    }
+
     Eclipse3DProperties::Eclipse3DProperties( const Deck&         deck,
                                               const TableManager& tableManager,
                                               const EclipseGrid&  eclipseGrid)
@@ -571,12 +584,22 @@ namespace Opm {
     }
 
     bool Eclipse3DProperties::supportsGridProperty(const std::string& keyword) const {
+        if (m_fieldPropsOnly)
+            return FieldPropsManager::supported<double>( keyword ) || FieldPropsManager::supported<int>( keyword );
+
         return m_doubleGridProperties.supportsKeyword( keyword ) || m_intGridProperties.supportsKeyword( keyword );
     }
 
 
 
     bool Eclipse3DProperties::hasDeckIntGridProperty(const std::string& keyword) const {
+        if (m_fieldPropsOnly) {
+            if (!FieldPropsManager::supported<int>( keyword ))
+                throw std::logic_error("Integer grid property " + keyword + " is unsupported!");
+
+            return m_fieldProps.has<int>( keyword );
+        }
+
         if (!m_intGridProperties.supportsKeyword( keyword ))
             throw std::logic_error("Integer grid property " + keyword + " is unsupported!");
 
@@ -584,6 +607,13 @@ namespace Opm {
     }
 
     bool Eclipse3DProperties::hasDeckDoubleGridProperty(const std::string& keyword) const {
+        if (m_fieldPropsOnly) {
+            if (!FieldPropsManager::supported<double>( keyword ))
+                throw std::logic_error("Double grid property " + keyword + " is unsupported!");
+
+            return m_fieldProps.has<double>( keyword );
+        }
+
         if (!m_doubleGridProperties.supportsKeyword( keyword ))
             throw std::logic_error("Double grid property " + keyword + " is unsupported!");
 
@@ -592,6 +622,7 @@ namespace Opm {
 
 
     const GridProperty<int>& Eclipse3DProperties::getIntGridProperty( const std::string& keyword ) const {
+        assertDeckProperties("getIntGridProperty");
         auto& gridProperty = const_cast< Eclipse3DProperties* >( this )->m_intGridProperties.getKeyword( keyword );
         gridProperty.runPostProcessor();
         return gridProperty;
@@ -601,6 +632,7 @@ namespace Opm {
 
     /// gets property from doubleGridProperty --- and calls the runPostProcessor
     const GridProperty<double>& Eclipse3DProperties::getDoubleGridProperty( const std::string& keyword ) const {
+        assertDeckProperties("getDoubleGridProperty");
         auto& gridProperty = const_cast< Eclipse3DProperties* >( this )->m_doubleGridProperties.getKeyword( keyword );
         gridProperty.runPostProcessor();
         return gridProperty;
@@ -616,6 +648,9 @@ namespace Opm {
 
 
     std::string Eclipse3DProperties::getDefaultRegionKeyword() const {
+        if (m_fieldPropsOnly)
+            return m_fieldProps.default_region();
+
         return m_defaultRegion;
     }
 
@@ -631,8 +666,9 @@ namespace Opm {
     std::vector< int > Eclipse3DProperties::getRegions( const std::string& keyword ) const {
         if( !this->hasDeckIntGridProperty( keyword ) ) return {};
 
-        const auto& property = this->getIntGridProperty( keyword );
-        auto data = property.getData();
+        const auto data = m_fieldPropsOnly
+            ? m_fieldProps.get_global<int>( keyword )
+            : this->getIntGridProperty( keyword ).getData();
         std::set< int > regions( data.begin(), data.end() );
 
         return { regions.begin(), regions.end() };
@@ -64,7 +64,7 @@ bool enable3DPropsTesting() {
 
 namespace {
 
-#ifdef ENABLE_3DPROPS_TESTING
+#if defined(ENABLE_3DPROPS_TESTING) && !defined(ENABLE_FIELDPROPS_ONLY)
 void assert_field_properties(const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties& ep) {
     std::vector<std::string> int_keywords = {"FLUXNUM",
                                              "MULTNUM",
@@ -150,15 +150,21 @@ void assert_field_properties(const EclipseGrid& grid, const FieldPropsManager& f
         m_inputNnc(          deck ),
         m_inputEditNnc(      deck ),
         m_inputGrid(         deck, nullptr ),
-        m_eclipseProperties( deck, m_tables, m_inputGrid ),
 #ifdef ENABLE_3DPROPS_TESTING
         field_props(         deck, m_inputGrid, m_tables),
+#endif
+#ifdef ENABLE_FIELDPROPS_ONLY
+        m_eclipseProperties( Eclipse3DProperties::FieldPropsOnly{}, field_props ),
+#else
+        m_eclipseProperties( deck, m_tables, m_inputGrid ),
 #endif
         m_simulationConfig(  m_eclipseConfig.getInitConfig().restartRequested(), deck, field_props, m_eclipseProperties ),
         m_transMult(         GridDims(deck), deck, field_props, m_eclipseProperties )
     {
 #ifdef ENABLE_3DPROPS_TESTING
+#ifndef ENABLE_FIELDPROPS_ONLY
         m_eclipseProperties.getIntGridProperty("ACTNUM").getData();
+#endif
         m_inputGrid.resetACTNUM(this->field_props.actnum());
 #else
         m_inputGrid.resetACTNUM(m_eclipseProperties.getIntGridProperty("ACTNUM").getData());
@@ -178,7 +184,9 @@ void assert_field_properties(const EclipseGrid& grid, const FieldPropsManager& f
         initFaults(deck);
 #ifdef ENABLE_3DPROPS_TESTING
         this->field_props.reset_actnum( this->m_inputGrid.getACTNUM() );
+#ifndef ENABLE_FIELDPROPS_ONLY
         assert_field_properties(this->m_inputGrid, this->field_props, this->m_eclipseProperties);
+#endif
 #endif
     }
 
@@ -143,39 +143,78 @@ namespace Opm {
 
 
     const std::vector<size_t>& Box::getIndexList() const {
+        this->initCellLists();
         return global_index_list;
     }
 
     const std::vector<Box::cell_index>& Box::index_list() const {
+        this->initCellLists();
         return m_index_list;
     }
 
+    const std::vector<Box::index_run>& Box::index_runs() const {
+        return m_index_runs;
+    }
+
 
     void Box::initIndexList() {
+        m_index_runs.clear();
         global_index_list.clear();
         m_index_list.clear();
+        m_cell_lists = false;
 
         size_t ii,ij,ik;
         for (ik=0; ik < m_dims[2]; ik++) {
             size_t k = ik + m_offset[2];
             for (ij=0; ij < m_dims[1]; ij++) {
                 size_t j = ij + m_offset[1];
+                bool in_run = false;
                 for (ii=0; ii < m_dims[0]; ii++) {
                     size_t i = ii + m_offset[0];
                     size_t g = i * m_stride[0] + j*m_stride[1] + k*m_stride[2];
 
-                    global_index_list.push_back(g);
                     if (this->grid.cellActive(g)) {
-                        std::size_t global_index = g;
-                        std::size_t active_index = this->grid.activeIndex(g);
-                        std::size_t data_index = ii + ij*this->m_dims[0] + ik*this->m_dims[0]*this->m_dims[1];
-                        m_index_list.push_back({global_index, active_index, data_index});
-                    }
+                        if (in_run)
+                            m_index_runs.back().length += 1;
+                        else {
+                            std::size_t active_index = this->grid.activeIndex(g);
+                            std::size_t data_index = ii + ij*this->m_dims[0] + ik*this->m_dims[0]*this->m_dims[1];
+                            m_index_runs.emplace_back(g, active_index, data_index, 1);
+                            in_run = true;
+                        }
+                    } else
+                        in_run = false;
                 }
             }
         }
     }
 
+
+    void Box::initCellLists() const {
+        if (m_cell_lists)
+            return;
+
+        global_index_list.reserve(this->size());
+        size_t ii,ij,ik;
+        for (ik=0; ik < m_dims[2]; ik++) {
+            size_t k = ik + m_offset[2];
+            for (ij=0; ij < m_dims[1]; ij++) {
+                size_t j = ij + m_offset[1];
+                for (ii=0; ii < m_dims[0]; ii++) {
+                    size_t i = ii + m_offset[0];
+                    global_index_list.push_back(i * m_stride[0] + j*m_stride[1] + k*m_stride[2]);
+                }
+            }
+        }
+
+        for (const auto& run : m_index_runs) {
+            for (std::size_t n = 0; n < run.length; n++)
+                m_index_list.emplace_back(run.global_index + n, run.active_index + n, run.data_index + n);
+        }
+
+        m_cell_lists = true;
+    }
+
     bool Box::equal(const Box& other) const {
 
         if (size() != other.size())
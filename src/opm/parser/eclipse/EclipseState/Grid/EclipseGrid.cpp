@@ -57,6 +57,49 @@
 
 namespace Opm {
 
+namespace {
+
+    double cornerCellDepth(const std::array<double,8>& Z) {
+        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+        return (z1 + z2)/2.0;
+    }
+
+    std::array<double, 3> cornerCellCenter(const std::array<double,8>& X,
+                                           const std::array<double,8>& Y,
+                                           const std::array<double,8>& Z) {
+        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+    }
+
+    std::array<double, 3> cornerCellDims(const std::array<double,8>& X,
+                                         const std::array<double,8>& Y,
+                                         const std::array<double,8>& Z) {
+        // calculate dx
+        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+
+        // calculate dy
+        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+
+        // calculate dz
+        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+        double dz = z2-z1;
+
+        return std::array<double,3> {{dx, dy, dz}};
+    }
+
+}
+
 
 EclipseGrid::EclipseGrid(std::array<int, 3>& dims ,
                          const std::vector<double>& coord ,
@@ -1352,6 +1395,10 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
     double EclipseGrid::getCellVolume(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        const auto active_index = m_global_to_active[globalIndex];
+        if (active_index >= 0)
+            return this->activeCellVolumes()[active_index];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
@@ -1375,48 +1422,21 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     }
 
     double EclipseGrid::getCellThickness(size_t globalIndex) const {
-        assertGlobalIndex( globalIndex );
-        std::array<double,8> X;
-        std::array<double,8> Y;
-        std::array<double,8> Z;
-        this->getCellCorners(globalIndex, X, Y, Z );
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-        return dz;
+        return this->getCellDims(globalIndex)[2];
     }
 
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        const auto active_index = m_global_to_active[globalIndex];
+        if (active_index >= 0)
+            return this->activeCellDims()[active_index];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-
-        // calculate dx
-        double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-        double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
-        double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-        double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
-        double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
-
-        // calculate dy
-        x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-        y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
-        x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-        y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
-        double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
-
-        // calculate dz
-
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        double dz = z2-z1;
-
-
-        return std::array<double,3> {{dx, dy, dz}};
+        return cornerCellDims(X, Y, Z);
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1430,13 +1450,15 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
     std::array<double, 3> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        const auto active_index = m_global_to_active[globalIndex];
+        if (active_index >= 0)
+            return this->activeCellCenters()[active_index];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
-        return std::array<double,3> { { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
-                                        std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
-                                        std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 } };
+        return cornerCellCenter(X, Y, Z);
     }
 
 
@@ -1490,14 +1512,79 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
     double EclipseGrid::getCellDepth(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
+        const auto active_index = m_global_to_active[globalIndex];
+        if (active_index >= 0)
+            return this->activeCellDepths()[active_index];
+
         std::array<double,8> X;
         std::array<double,8> Y;
         std::array<double,8> Z;
         this->getCellCorners(globalIndex, X, Y, Z );
+        return cornerCellDepth(Z);
+    }
 
-        double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-        double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
-        return (z1 + z2)/2.0;
+    /*
+      A geometric quantity is calculated for all active cells in one sweep
+      the first time it is needed, and then shared by all subsequent
+      callers. The cells are visited in active index order, i.e.
+      contiguously through the ZCORN array. Concurrent first callers wait
+      for the one calculation in std::call_once().
+    */
+    template <typename T, typename Calculate>
+    std::vector<T> EclipseGrid::calculateActiveCells(Calculate&& calculate) const {
+        std::vector<T> values( m_nactive );
+
+        const auto dims = this->getNXYZ();
+        const long nactive = m_nactive;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (long active_index = 0; active_index < nactive; active_index++) {
+            std::array<double,8> X;
+            std::array<double,8> Y;
+            std::array<double,8> Z;
+            const auto ijk = this->getIJK( m_active_to_global[active_index] );
+            this->getCellCorners(ijk, dims, X, Y, Z );
+
+            values[active_index] = calculate(X, Y, Z);
+        }
+
+        return values;
+    }
+
+    const std::vector<double>& EclipseGrid::activeCellVolumes() const {
+        auto& cache = *this->m_cell_geometry;
+        std::call_once(cache.volume_once, [this, &cache]() {
+            cache.volume = this->calculateActiveCells<double>(calculateCellVol);
+        });
+        return cache.volume;
+    }
+
+    const std::vector<double>& EclipseGrid::activeCellDepths() const {
+        auto& cache = *this->m_cell_geometry;
+        std::call_once(cache.depth_once, [this, &cache]() {
+            cache.depth = this->calculateActiveCells<double>(
+                [](const std::array<double,8>&, const std::array<double,8>&, const std::array<double,8>& Z)
+                { return cornerCellDepth(Z); });
+        });
+        return cache.depth;
+    }
+
+    const std::vector<std::array<double, 3>>& EclipseGrid::activeCellCenters() const {
+        auto& cache = *this->m_cell_geometry;
+        std::call_once(cache.center_once, [this, &cache]() {
+            cache.center = this->calculateActiveCells<std::array<double, 3>>(cornerCellCenter);
+        });
+        return cache.center;
+    }
+
+    const std::vector<std::array<double, 3>>& EclipseGrid::activeCellDims() const {
+        auto& cache = *this->m_cell_geometry;
+        std::call_once(cache.dims_once, [this, &cache]() {
+            cache.dims = this->calculateActiveCells<std::array<double, 3>>(cornerCellDims);
+        });
+        return cache.dims;
     }
 
     double EclipseGrid::getCellDepth(size_t i, size_t j, size_t k) const {
@@ -1525,6 +1612,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
+        this->m_cell_geometry.reset();
         return mapper.fixupZCORN( m_zcorn );
     }
 
@@ -1540,23 +1628,8 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
         const std::array<int, 3> dims = getNXYZ();
 
-        // Preparing vectors to be saved
-
-        // create coord vector of floats with input units, converted from SI
-        std::vector<float> coord_f;
-        coord_f.resize(m_coord.size());
-
-        for (size_t n=0; n< m_coord.size(); n++){
-            coord_f[n] = static_cast<double>(units.from_si(length, m_coord[n]));
-        }
-
-        // create zcorn vector of floats with input units, converted from SI
-        std::vector<float> zcorn_f;
-        zcorn_f.resize(m_zcorn.size());
-
-        for (size_t n=0; n< m_zcorn.size(); n++){
-            zcorn_f[n] = static_cast<double>(units.from_si(length, m_zcorn[n]));
-        }
+        // Preparing vectors to be saved. COORD and ZCORN are converted
+        // from SI to float in input units block by block while writing.
 
         std::vector<float> mapaxes_f;
 
@@ -1635,8 +1708,12 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         egridfile.write("GRIDUNIT", gridunits);
         egridfile.write("GRIDHEAD", gridhead);
 
-        egridfile.write("COORD", coord_f);
-        egridfile.write("ZCORN", zcorn_f);
+        egridfile.write<float>("COORD", m_coord.size(), [this, &units, length](std::size_t n) {
+            return static_cast<float>(units.from_si(length, m_coord[n]));
+        });
+        egridfile.write<float>("ZCORN", m_zcorn.size(), [this, &units, length](std::size_t n) {
+            return static_cast<float>(units.from_si(length, m_zcorn[n]));
+        });
 
         egridfile.write("ACTNUM", m_actnum);
         egridfile.write("ENDGRID", endgrid);
@@ -1654,6 +1731,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     }
 
     void EclipseGrid::resetACTNUM() {
+        this->m_cell_geometry.reset();
 
         const std::array<int, 3> dims = getNXYZ();
         m_nactive = dims[0]*dims[1]*dims[2];
@@ -1675,6 +1753,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             throw std::runtime_error("resetACTNUM(): actnum vector size differs from logical cartesian size of grid.");
         }
 
+        this->m_cell_geometry.reset();
         m_actnum = actnum;
         m_global_to_active.clear();
         m_active_to_global.clear();
@@ -17,6 +17,8 @@
 */
 #include <functional>
 #include <algorithm>
+#include <atomic>
+#include <exception>
 
 #include <opm/parser/eclipse/Parser/ParserKeywords/A.hpp>
 #include <opm/parser/eclipse/Parser/ParserKeywords/B.hpp>
@@ -243,35 +245,101 @@ void verify_deck_data(const DeckKeyword& keyword, const std::vector<T>& deck_dat
 }
 
 
+/*
+  The kernels below operate on runs of consecutive active cells, which
+  is the representation used both for boxes and for regions. For a run
+  the inner loop is over consecutive active and data indices.
+
+  Each cell is visited exactly once, and with more than one thread
+  configured large index sets are processed in parallel; the functor must
+  therefore only touch the given cell and must not throw.
+*/
+const std::size_t min_parallel_cells = 4096;
+int fieldprops_threads = 1;
+
+bool parallel_runs(const std::vector<Box::index_run>& index_runs) {
+    return fieldprops_threads > 1 && index_runs.size() * 8 >= min_parallel_cells;
+}
+
+template <typename F>
+void for_each_index(const std::vector<Box::index_run>& index_runs, F&& func) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(fieldprops_threads) if (parallel_runs(index_runs))
+#endif
+    for (std::size_t index = 0; index < index_runs.size(); index++) {
+        const auto& run = index_runs[index];
+        const std::size_t active_end = run.active_index + run.length;
+        std::size_t data_index = run.data_index;
+        for (std::size_t active_index = run.active_index; active_index < active_end; active_index++, data_index++)
+            func(active_index, data_index);
+    }
+}
+
+
+/*
+  Calls func(active_index, data_index, length, status) for the pieces of the
+  box runs where the status of the deck values is constant, so the kernels
+  below can work on the run length encoded status of the deck item without
+  expanding it.
+*/
+template <typename F>
+void for_each_status_run(const std::vector<Box::index_run>& index_runs, const std::vector<value::status_run>& status_runs, F&& func) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(fieldprops_threads) if (parallel_runs(index_runs))
+#endif
+    for (std::size_t index = 0; index < index_runs.size(); index++) {
+        const auto& run = index_runs[index];
+        auto status_run = std::upper_bound(status_runs.begin(), status_runs.end(), run.data_index,
+                                           [](std::size_t data_index, const value::status_run& sr) { return data_index < sr.end; });
+        std::size_t offset = 0;
+        while (offset < run.length) {
+            const std::size_t data_index = run.data_index + offset;
+            const std::size_t length = std::min(run.length - offset, status_run->end - data_index);
+            func(run.active_index + offset, data_index, length, status_run->value_status);
+            offset += length;
+            ++status_run;
+        }
+    }
+}
+
+
 template <typename T>
-void assign_deck(const DeckKeyword& keyword, FieldProps::FieldData<T>& field_data, const std::vector<T>& deck_data, const std::vector<value::status>& deck_status, const Box& box) {
+void assign_deck(const DeckKeyword& keyword, FieldProps::FieldData<T>& field_data, const std::vector<T>& deck_data, const std::vector<value::status_run>& deck_status, const Box& box) {
     verify_deck_data(keyword, deck_data, box);
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
-
-        if (value::has_value(deck_status[data_index])) {
-            if (deck_status[data_index] == value::status::deck_value || field_data.value_status[active_index] == value::status::uninitialized) {
-                field_data.data[active_index] = deck_data[data_index];
-                field_data.value_status[active_index] = deck_status[data_index];
+    for_each_status_run(box.index_runs(), deck_status, [&](std::size_t active_index, std::size_t data_index, std::size_t length, value::status status) {
+        if (!value::has_value(status))
+            return;
+
+        if (status == value::status::deck_value) {
+            std::copy_n(deck_data.begin() + data_index, length, field_data.data.begin() + active_index);
+            std::fill_n(field_data.value_status.begin() + active_index, length, status);
+            return;
+        }
+
+        for (std::size_t n = 0; n < length; n++) {
+            if (field_data.value_status[active_index + n] == value::status::uninitialized) {
+                field_data.data[active_index + n] = deck_data[data_index + n];
+                field_data.value_status[active_index + n] = status;
             }
         }
-    }
+    });
 }
 
 
 template <typename T>
-void multiply_deck(const DeckKeyword& keyword, FieldProps::FieldData<T>& field_data, const std::vector<T>& deck_data, const std::vector<value::status>& deck_status, const Box& box) {
+void multiply_deck(const DeckKeyword& keyword, FieldProps::FieldData<T>& field_data, const std::vector<T>& deck_data, const std::vector<value::status_run>& deck_status, const Box& box) {
     verify_deck_data(keyword, deck_data, box);
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
+    for_each_status_run(box.index_runs(), deck_status, [&](std::size_t active_index, std::size_t data_index, std::size_t length, value::status status) {
+        if (!value::has_value(status))
+            return;
 
-        if (value::has_value(deck_status[data_index]) && value::has_value(field_data.value_status[active_index])) {
-            field_data.data[active_index] *= deck_data[data_index];
-            field_data.value_status[active_index] = deck_status[data_index];
+        for (std::size_t n = 0; n < length; n++) {
+            if (value::has_value(field_data.value_status[active_index + n])) {
+                field_data.data[active_index + n] *= deck_data[data_index + n];
+                field_data.value_status[active_index + n] = status;
+            }
         }
-    }
+    });
 }
 
 
@@ -279,10 +347,10 @@ template <typename T>
 void distribute_toplayer(const EclipseGrid& grid, FieldProps::FieldData<T>& field_data, const std::vector<T>& deck_data, const Box& box) {
     const std::size_t layer_size = grid.getNX() * grid.getNY();
     FieldProps::FieldData<double> toplayer(grid.getNX() * grid.getNY());
-    for (const auto& cell_index : box.index_list()) {
-        if (cell_index.global_index < layer_size) {
-            toplayer.data[cell_index.global_index] = deck_data[cell_index.data_index];
-            toplayer.value_status[cell_index.global_index] = value::status::deck_value;
+    for (const auto& run : box.index_runs()) {
+        for (std::size_t n = 0; n < run.length && run.global_index + n < layer_size; n++) {
+            toplayer.data[run.global_index + n] = deck_data[run.data_index + n];
+            toplayer.value_status[run.global_index + n] = value::status::deck_value;
         }
     }
 
@@ -301,47 +369,47 @@ void distribute_toplayer(const EclipseGrid& grid, FieldProps::FieldData<T>& fiel
 
 
 template <typename T>
-void assign_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::cell_index>& index_list) {
-    for (const auto& cell_index : index_list) {
-        field_data.data[cell_index.active_index] = value;
-        field_data.value_status[cell_index.active_index] = value::status::deck_value;
-    }
+void assign_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::index_run>& index_list) {
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        field_data.data[active_index] = value;
+        field_data.value_status[active_index] = value::status::deck_value;
+    });
 }
 
 template <typename T>
-void multiply_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::cell_index>& index_list) {
-    for (const auto& cell_index : index_list) {
-        if (value::has_value(field_data.value_status[cell_index.active_index]))
-            field_data.data[cell_index.active_index] *= value;
-    }
+void multiply_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::index_run>& index_list) {
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        if (value::has_value(field_data.value_status[active_index]))
+            field_data.data[active_index] *= value;
+    });
 }
 
 template <typename T>
-void add_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::cell_index>& index_list) {
-    for (const auto& cell_index : index_list) {
-        if (value::has_value(field_data.value_status[cell_index.active_index]))
-            field_data.data[cell_index.active_index] += value;
-    }
+void add_scalar(FieldProps::FieldData<T>& field_data, T value, const std::vector<Box::index_run>& index_list) {
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        if (value::has_value(field_data.value_status[active_index]))
+            field_data.data[active_index] += value;
+    });
 }
 
 template <typename T>
-void min_value(FieldProps::FieldData<T>& field_data, T min_value, const std::vector<Box::cell_index>& index_list) {
-    for (const auto& cell_index : index_list) {
-        if (value::has_value(field_data.value_status[cell_index.active_index])) {
-            T value = field_data.data[cell_index.active_index];
-            field_data.data[cell_index.active_index] = std::max(value, min_value);
+void min_value(FieldProps::FieldData<T>& field_data, T min_value, const std::vector<Box::index_run>& index_list) {
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        if (value::has_value(field_data.value_status[active_index])) {
+            T value = field_data.data[active_index];
+            field_data.data[active_index] = std::max(value, min_value);
         }
-    }
+    });
 }
 
 template <typename T>
-void max_value(FieldProps::FieldData<T>& field_data, T max_value, const std::vector<Box::cell_index>& index_list) {
-    for (const auto& cell_index : index_list) {
-        if (value::has_value(field_data.value_status[cell_index.active_index])) {
-            T value = field_data.data[cell_index.active_index];
-            field_data.data[cell_index.active_index] = std::min(value, max_value);
+void max_value(FieldProps::FieldData<T>& field_data, T max_value, const std::vector<Box::index_run>& index_list) {
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        if (value::has_value(field_data.value_status[active_index])) {
+            T value = field_data.data[active_index];
+            field_data.data[active_index] = std::min(value, max_value);
         }
-    }
+    });
 }
 
 std::string make_region_name(const std::string& deck_value) {
@@ -455,6 +523,8 @@ FieldProps::FieldProps(const Deck& deck, const EclipseGrid& grid, const TableMan
 
     if (DeckSection::hasSOLUTION(deck))
         this->scanSOLUTIONSection(SOLUTIONSection(deck));
+
+    this->region_cache.clear();
 }
 
 
@@ -492,6 +562,7 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum) {
     FieldProps::compress(this->cell_volume, active_map);
     FieldProps::compress(this->cell_depth, active_map);
 
+    this->region_cache.clear();
     this->m_actnum = std::move(new_actnum);
     this->active_size = new_active_size;
 }
@@ -500,10 +571,10 @@ void FieldProps::reset_actnum(const std::vector<int>& new_actnum) {
 void FieldProps::distribute_toplayer(FieldProps::FieldData<double>& field_data, const std::vector<double>& deck_data, const Box& box) {
     const std::size_t layer_size = this->nx * this->ny;
     FieldProps::FieldData<double> toplayer(layer_size);
-    for (const auto& cell_index : box.index_list()) {
-        if (cell_index.global_index < layer_size) {
-            toplayer.data[cell_index.global_index] = deck_data[cell_index.data_index];
-            toplayer.value_status[cell_index.global_index] = value::status::deck_value;
+    for (const auto& run : box.index_runs()) {
+        for (std::size_t n = 0; n < run.length && run.global_index + n < layer_size; n++) {
+            toplayer.data[run.global_index + n] = deck_data[run.data_index + n];
+            toplayer.value_status[run.global_index + n] = value::status::deck_value;
         }
     }
 
@@ -528,6 +599,14 @@ void FieldProps::distribute_toplayer(FieldProps::FieldData<double>& field_data,
 }
 
 
+void FieldProps::set_threads(int num_threads) {
+    fieldprops_threads = std::max(1, num_threads);
+}
+
+int FieldProps::threads() {
+    return fieldprops_threads;
+}
+
 template <>
 bool FieldProps::supported<double>(const std::string& keyword) {
     if (keywords::GRID::double_keywords.count(keyword) != 0)
@@ -608,25 +687,47 @@ FieldProps::FieldData<int>& FieldProps::init_get(const std::string& keyword) {
     return this->int_data[keyword];
 }
 
-std::vector<Box::cell_index> FieldProps::region_index( const std::string& region_name, int region_value ) {
-    const auto& region = this->init_get<int>(region_name);
-    if (!region.valid())
-        throw std::invalid_argument("Trying to work with invalid region: " + region_name);
+/*
+  The cells of a region array are indexed by region value, as runs of
+  consecutive active cells, the first time the region array is used in a
+  region operation. The index is discarded when the region array is
+  modified, and all indices are released when the deck has been
+  processed.
+*/
+const std::vector<Box::index_run>& FieldProps::region_index( const std::string& region_name, int region_value ) {
+    static const std::vector<Box::index_run> empty_region;
 
-    std::vector<Box::cell_index> index_list;
-    std::size_t active_index = 0;
-    const auto& region_data = region.data;
-    for (std::size_t g = 0; g < this->m_actnum.size(); g++) {
-        if (this->m_actnum[g] != 0) {
-            if (region_data[active_index] == region_value)
-                index_list.emplace_back( g, active_index, g );
-            active_index += 1;
+    auto cache_iter = this->region_cache.find(region_name);
+    if (cache_iter == this->region_cache.end()) {
+        const auto& region = this->init_get<int>(region_name);
+        if (!region.valid())
+            throw std::invalid_argument("Trying to work with invalid region: " + region_name);
+
+        std::unordered_map<int, std::vector<Box::index_run>> region_cells;
+        std::size_t active_index = 0;
+        const auto& region_data = region.data;
+        for (std::size_t g = 0; g < this->m_actnum.size(); g++) {
+            if (this->m_actnum[g] != 0) {
+                auto& runs = region_cells[region_data[active_index]];
+                if (!runs.empty() && runs.back().global_index + runs.back().length == g && runs.back().active_index + runs.back().length == active_index)
+                    runs.back().length += 1;
+                else
+                    runs.emplace_back( g, active_index, g, 1 );
+                active_index += 1;
+            }
         }
+        cache_iter = this->region_cache.emplace( region_name, std::move(region_cells) ).first;
     }
-    return index_list;
+
+    const auto& region_cells = cache_iter->second;
+    auto iter = region_cells.find(region_value);
+    if (iter == region_cells.end())
+        return empty_region;
+
+    return iter->second;
 }
 
-std::vector<Box::cell_index> FieldProps::region_index( const DeckItem& region_item, int region_value ) {
+const std::vector<Box::index_run>& FieldProps::region_index( const DeckItem& region_item, int region_value ) {
     std::string region_name = region_item.defaultApplied(0) ? this->m_default_region : make_region_name(region_item.get<std::string>(0));
     return this->region_index(region_name, region_value);
 }
@@ -673,6 +774,7 @@ std::vector<std::string> FieldProps::keys<int>() const {
 
 template <>
 void FieldProps::erase<int>(const std::string& keyword) {
+    this->region_cache.erase(keyword);
     this->int_data.erase(keyword);
 }
 
@@ -687,6 +789,7 @@ std::vector<int> FieldProps::extract<int>(const std::string& keyword) {
     auto field = std::move(field_iter->second);
     std::vector<int> data = std::move( field.data );
     this->int_data.erase( field_iter );
+    this->region_cache.erase(keyword);
     return data;
 }
 
@@ -720,15 +823,25 @@ double FieldProps::getSIValue(const std::string& keyword, double raw_value) cons
 void FieldProps::handle_int_keyword(const DeckKeyword& keyword, const Box& box) {
     auto& field_data = this->init_get<int>(keyword.name());
     const auto& deck_data = keyword.getIntData();
-    const auto& deck_status = keyword.getValueStatus();
+    const auto& deck_status = keyword.getValueStatusRuns();
     assign_deck(keyword, field_data, deck_data, deck_status, box);
+    this->region_cache.erase(keyword.name());
 }
 
 
 void FieldProps::handle_double_keyword(Section section, const DeckKeyword& keyword, const Box& box) {
     auto& field_data = this->init_get<double>(keyword.name());
+    this->load_double_keyword(section, keyword, field_data, box);
+}
+
+
+/*
+  Only touches field_data and the keyword itself, and can therefore run
+  concurrently for different keywords.
+*/
+void FieldProps::load_double_keyword(Section section, const DeckKeyword& keyword, FieldData<double>& field_data, const Box& box) {
     const auto& deck_data = keyword.getSIDoubleData();
-    const auto& deck_status = keyword.getValueStatus();
+    const auto& deck_status = keyword.getValueStatusRuns();
 
     if (section == Section::EDIT && keywords::multiplier_keywords.count(keyword.name()) == 1)
         multiply_deck(keyword, field_data, deck_data, deck_status, box);
@@ -747,8 +860,78 @@ void FieldProps::handle_double_keyword(Section section, const DeckKeyword& keywo
 
 
 
+void FieldProps::queue_data_keyword(Section section, std::vector<DataKeyword>& queue, const DeckKeyword& keyword, bool int_keyword, const Box& box) {
+    const std::string& name = keyword.name();
+    bool flush = std::any_of(queue.begin(), queue.end(), [&name](const DataKeyword& data_keyword) { return data_keyword.keyword->name() == name; });
+
+    // The initial values of these keywords are derived from other arrays,
+    // which must be complete before the keyword is initialized.
+    if (!int_keyword && this->double_data.count(name) == 0) {
+        if (keywords::PROPS::satfunc.count(name) == 1 ||
+            name == ParserKeywords::PORV::keywordName ||
+            name == ParserKeywords::TEMPI::keywordName)
+            flush = true;
+    }
+
+    if (flush)
+        this->handle_data_keywords(section, queue, box);
+
+    queue.push_back({&keyword, int_keyword});
+}
+
+
+void FieldProps::handle_data_keywords(Section section, std::vector<DataKeyword>& queue, const Box& box) {
+    if (queue.size() == 1) {
+        const auto& data_keyword = queue.front();
+        if (data_keyword.int_keyword)
+            this->handle_int_keyword(*data_keyword.keyword, box);
+        else
+            this->handle_double_keyword(section, *data_keyword.keyword, box);
+    } else if (queue.size() > 1) {
+        // Creating and initializing the arrays modifies the containers,
+        // and is done up front in deck order.
+        std::vector<FieldData<double>*> double_fields(queue.size(), nullptr);
+        std::vector<FieldData<int>*> int_fields(queue.size(), nullptr);
+        for (std::size_t index = 0; index < queue.size(); index++) {
+            const auto& name = queue[index].keyword->name();
+            if (queue[index].int_keyword)
+                int_fields[index] = &this->init_get<int>(name);
+            else
+                double_fields[index] = &this->init_get<double>(name);
+        }
+
+        std::vector<std::exception_ptr> errors(queue.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(fieldprops_threads) if (fieldprops_threads > 1)
+#endif
+        for (std::size_t index = 0; index < queue.size(); index++) {
+            const auto& keyword = *queue[index].keyword;
+            try {
+                if (queue[index].int_keyword)
+                    assign_deck(keyword, *int_fields[index], keyword.getIntData(), keyword.getValueStatusRuns(), box);
+                else
+                    this->load_double_keyword(section, keyword, *double_fields[index], box);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        }
+
+        for (std::size_t index = 0; index < queue.size(); index++) {
+            if (errors[index])
+                std::rethrow_exception(errors[index]);
+
+            if (queue[index].int_keyword)
+                this->region_cache.erase(queue[index].keyword->name());
+        }
+    }
+
+    queue.clear();
+}
+
+
+
 template <typename T>
-void FieldProps::apply(ScalarOperation op, FieldData<T>& data, T scalar_value, const std::vector<Box::cell_index>& index_list) {
+void FieldProps::apply(ScalarOperation op, FieldData<T>& data, T scalar_value, const std::vector<Box::index_run>& index_list) {
     if (op == ScalarOperation::EQUAL)
         assign_scalar(data, scalar_value, index_list);
 
@@ -766,23 +949,27 @@ void FieldProps::apply(ScalarOperation op, FieldData<T>& data, T scalar_value, c
 }
 
 template <typename T>
-void FieldProps::apply(const DeckRecord& record, FieldData<T>& target_data, const FieldData<T>& src_data, const std::vector<Box::cell_index>& index_list) {
+void FieldProps::apply(const DeckRecord& record, FieldData<T>& target_data, const FieldData<T>& src_data, const std::vector<Box::index_run>& index_list) {
     const std::string& func_name = record.getItem("OPERATION").get< std::string >(0);
     const double alpha           = record.getItem("PARAM1").get< double >(0);
     const double beta            = record.getItem("PARAM2").get< double >(0);
     Operate::function func       = Operate::get( func_name, alpha, beta );
     bool check_target            = (func_name == "MULTIPLY" || func_name == "POLY");
 
-    for (const auto& cell_index : index_list) {
-        if (value::has_value(src_data.value_status[cell_index.active_index])) {
-            if ((check_target == false) || (value::has_value(target_data.value_status[cell_index.active_index]))) {
-                target_data.data[cell_index.active_index]         = func(target_data.data[cell_index.active_index], src_data.data[cell_index.active_index]);
-                target_data.value_status[cell_index.active_index] = src_data.value_status[cell_index.active_index];
+    std::atomic<bool> unset_value(false);
+    for_each_index(index_list, [&](std::size_t active_index, std::size_t) {
+        if (value::has_value(src_data.value_status[active_index])) {
+            if ((check_target == false) || (value::has_value(target_data.value_status[active_index]))) {
+                target_data.data[active_index]         = func(target_data.data[active_index], src_data.data[active_index]);
+                target_data.value_status[active_index] = src_data.value_status[active_index];
             } else
-                throw std::invalid_argument("Tried to use unset property value in OPERATE/OPERATER keyword");
+                unset_value = true;
         } else
-            throw std::invalid_argument("Tried to use unset property value in OPERATE/OPERATER keyword");
-    }
+            unset_value = true;
+    });
+
+    if (unset_value)
+        throw std::invalid_argument("Tried to use unset property value in OPERATE/OPERATER keyword");
 }
 
 void FieldProps::handle_region_operation(const DeckKeyword& keyword) {
@@ -831,12 +1018,12 @@ void FieldProps::handle_operation(const DeckKeyword& keyword, Box box) {
             if (keyword.name() == ParserKeywords::OPERATE::keywordName) {
                 const std::string& src_kw = record.getItem("ARRAY").get<std::string>(0);
                 const auto& src_data = this->init_get<double>(src_kw);
-                FieldProps::apply(record, field_data, src_data, box.index_list());
+                FieldProps::apply(record, field_data, src_data, box.index_runs());
             } else {
                 double scalar_value = record.getItem(1).get<double>(0);
                 if (keyword.name() != ParserKeywords::MULTIPLY::keywordName)
                     scalar_value = this->getSIValue(target_kw, scalar_value);
-                FieldProps::apply(fromString(keyword.name()), field_data, scalar_value, box.index_list());
+                FieldProps::apply(fromString(keyword.name()), field_data, scalar_value, box.index_runs());
             }
 
             continue;
@@ -846,7 +1033,8 @@ void FieldProps::handle_operation(const DeckKeyword& keyword, Box box) {
         if (FieldProps::supported<int>(target_kw)) {
             int scalar_value = static_cast<int>(record.getItem(1).get<double>(0));
             auto& field_data = this->init_get<int>(target_kw);
-            FieldProps::apply(fromString(keyword.name()), field_data, scalar_value, box.index_list());
+            FieldProps::apply(fromString(keyword.name()), field_data, scalar_value, box.index_runs());
+            this->region_cache.erase(target_kw);
             continue;
         }
 
@@ -859,16 +1047,14 @@ void FieldProps::handle_COPY(const DeckKeyword& keyword, Box box, bool region) {
     for (const auto& record : keyword) {
         const std::string& src_kw = record.getItem(0).get<std::string>(0);
         const std::string& target_kw = record.getItem(1).get<std::string>(0);
-        std::vector<Box::cell_index> index_list;
+        const std::vector<Box::index_run>* index_ptr = nullptr;
 
         if (region) {
             int region_value = record.getItem(2).get<int>(0);
             const auto& region_item = record.getItem(4);
-            index_list = this->region_index(region_item, region_value);
-        } else {
+            index_ptr = &this->region_index(region_item, region_value);
+        } else
             box.update(record);
-            index_list = box.index_list();
-        }
 
 
         if (FieldProps::supported<double>(src_kw)) {
@@ -876,7 +1062,10 @@ void FieldProps::handle_COPY(const DeckKeyword& keyword, Box box, bool region) {
             src_data.verify_status();
 
             auto& target_data = this->init_get<double>(target_kw);
-            target_data.copy(src_data.field_data(), index_list);
+            if (index_ptr)
+                target_data.copy(src_data.field_data(), *index_ptr);
+            else
+                target_data.copy(src_data.field_data(), box.index_runs());
             continue;
         }
 
@@ -885,7 +1074,11 @@ void FieldProps::handle_COPY(const DeckKeyword& keyword, Box box, bool region) {
             src_data.verify_status();
 
             auto& target_data = this->init_get<int>(target_kw);
-            target_data.copy(src_data.field_data(), index_list);
+            if (index_ptr)
+                target_data.copy(src_data.field_data(), *index_ptr);
+            else
+                target_data.copy(src_data.field_data(), box.index_runs());
+            this->region_cache.erase(target_kw);
             continue;
         }
     }
@@ -958,8 +1151,9 @@ void FieldProps::init_porv(FieldData<double>& porv) {
 
     for (const auto& mregp: this->multregp) {
         const auto& index_list = this->region_index(mregp.region_name, mregp.region_value);
-        for (const auto& cell_index : index_list)
-            porv_data[cell_index.active_index] *= mregp.multiplier;
+        for (const auto& run : index_list)
+            std::transform(porv_data.begin() + run.active_index, porv_data.begin() + run.active_index + run.length,
+                           porv_data.begin() + run.active_index, [&mregp](double porv_value) { return porv_value * mregp.multiplier; });
     }
 }
 
@@ -1012,40 +1206,46 @@ std::vector<int> FieldProps::actnum() {
 
 void FieldProps::scanGRIDSection(const GRIDSection& grid_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
 
     for (const auto& keyword : grid_section) {
         const std::string& name = keyword.name();
 
         if (keywords::GRID::double_keywords.count(name) == 1) {
-            this->handle_double_keyword(Section::GRID, keyword, box);
+            this->queue_data_keyword(Section::GRID, data_keywords, keyword, false, box);
             continue;
         }
 
         if (keywords::GRID::int_keywords.count(name) == 1) {
-            this->handle_int_keyword(keyword, box);
+            this->queue_data_keyword(Section::GRID, data_keywords, keyword, true, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::GRID, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::GRID, data_keywords, box);
 }
 
 void FieldProps::scanEDITSection(const EDITSection& edit_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
     for (const auto& keyword : edit_section) {
         const std::string& name = keyword.name();
         if (keywords::EDIT::double_keywords.count(name) == 1) {
-            this->handle_double_keyword(Section::EDIT, keyword, box);
+            this->queue_data_keyword(Section::EDIT, data_keywords, keyword, false, box);
             continue;
         }
 
         if (keywords::EDIT::int_keywords.count(name) == 1) {
-            this->handle_int_keyword(keyword, box);
+            this->queue_data_keyword(Section::EDIT, data_keywords, keyword, true, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::EDIT, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::EDIT, data_keywords, box);
 }
 
 
@@ -1081,73 +1281,86 @@ void FieldProps::subtract_swl(FieldProps::FieldData<double>& sogcr, const std::s
 
 void FieldProps::scanPROPSSection(const PROPSSection& props_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
 
     for (const auto& keyword : props_section) {
         const std::string& name = keyword.name();
         if (keywords::PROPS::satfunc.count(name) == 1) {
-            this->handle_double_keyword(Section::PROPS, keyword, box);
+            this->queue_data_keyword(Section::PROPS, data_keywords, keyword, false, box);
             continue;
         }
 
         if (keywords::PROPS::double_keywords.count(name) == 1) {
-            this->handle_double_keyword(Section::PROPS, keyword, box);
+            this->queue_data_keyword(Section::PROPS, data_keywords, keyword, false, box);
             continue;
         }
 
         if (keywords::PROPS::int_keywords.count(name) == 1) {
-            this->handle_int_keyword(keyword, box);
+            this->queue_data_keyword(Section::PROPS, data_keywords, keyword, true, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::PROPS, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::PROPS, data_keywords, box);
 }
 
 
 void FieldProps::scanREGIONSSection(const REGIONSSection& regions_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
 
     for (const auto& keyword : regions_section) {
         const std::string& name = keyword.name();
         if (keywords::REGIONS::int_keywords.count(name) == 1) {
-            this->handle_int_keyword(keyword, box);
+            this->queue_data_keyword(Section::REGIONS, data_keywords, keyword, true, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::REGIONS, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::REGIONS, data_keywords, box);
 }
 
 
 void FieldProps::scanSOLUTIONSection(const SOLUTIONSection& solution_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
     for (const auto& keyword : solution_section) {
         const std::string& name = keyword.name();
         if (keywords::SOLUTION::double_keywords.count(name) == 1) {
-            this->handle_double_keyword(Section::SOLUTION, keyword, box);
+            this->queue_data_keyword(Section::SOLUTION, data_keywords, keyword, false, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::SOLUTION, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::SOLUTION, data_keywords, box);
 }
 
 void FieldProps::scanSCHEDULESection(const SCHEDULESection& schedule_section) {
     Box box(*this->grid_ptr);
+    std::vector<DataKeyword> data_keywords;
     for (const auto& keyword : schedule_section) {
         const std::string& name = keyword.name();
         if (keywords::SCHEDULE::double_keywords.count(name) == 1) {
-            this->handle_double_keyword(Section::SCHEDULE, keyword, box);
+            this->queue_data_keyword(Section::SCHEDULE, data_keywords, keyword, false, box);
             continue;
         }
 
         if (keywords::SCHEDULE::int_keywords.count(name) == 1) {
-            this->handle_int_keyword(keyword, box);
+            this->queue_data_keyword(Section::SCHEDULE, data_keywords, keyword, true, box);
             continue;
         }
 
+        this->handle_data_keywords(Section::SCHEDULE, data_keywords, box);
         this->handle_keyword(keyword, box);
     }
+    this->handle_data_keywords(Section::SCHEDULE, data_keywords, box);
+    this->region_cache.clear();
 }
 
 const std::string& FieldProps::default_region() const {
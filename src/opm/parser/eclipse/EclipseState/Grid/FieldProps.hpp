@@ -19,6 +19,7 @@
 #ifndef FIELDPROPS_HPP
 #define FIELDPROPS_HPP
 
+#include <algorithm>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -121,10 +122,10 @@ public:
             FieldProps::compress(this->value_status, active_map);
         }
 
-        void copy(const FieldData<T>& src, const std::vector<Box::cell_index>& index_list) {
-            for (const auto& ci : index_list) {
-                this->data[ci.active_index] = src.data[ci.active_index];
-                this->value_status[ci.active_index] = src.value_status[ci.active_index];
+        void copy(const FieldData<T>& src, const std::vector<Box::index_run>& index_runs) {
+            for (const auto& run : index_runs) {
+                std::copy_n(src.data.begin() + run.active_index, run.length, this->data.begin() + run.active_index);
+                std::copy_n(src.value_status.begin() + run.active_index, run.length, this->value_status.begin() + run.active_index);
             }
         }
 
@@ -223,6 +224,9 @@ public:
     template <typename T>
     static bool supported(const std::string& keyword);
 
+    static void set_threads(int num_threads);
+    static int threads();
+
     template <typename T>
     bool has(const std::string& keyword) const;
 
@@ -328,25 +332,45 @@ private:
     template <typename T>
     std::vector<T> extract(const std::string& keyword);
 
+    /*
+      The index_list argument holds the runs of active cells of a box or a
+      region.
+    */
     template <typename T>
-    void apply(const DeckRecord& record, FieldData<T>& target_data, const FieldData<T>& src_data, const std::vector<Box::cell_index>& index_list);
+    void apply(const DeckRecord& record, FieldData<T>& target_data, const FieldData<T>& src_data, const std::vector<Box::index_run>& index_list);
 
     template <typename T>
-    static void apply(ScalarOperation op, FieldData<T>& data, T scalar_value, const std::vector<Box::cell_index>& index_list);
+    static void apply(ScalarOperation op, FieldData<T>& data, T scalar_value, const std::vector<Box::index_run>& index_list);
 
     template <typename T>
     FieldData<T>& init_get(const std::string& keyword);
 
-    std::vector<Box::cell_index> region_index( const DeckItem& regionItem, int region_value );
-    std::vector<Box::cell_index> region_index( const std::string& region_name, int region_value );
+    const std::vector<Box::index_run>& region_index( const DeckItem& regionItem, int region_value );
+    const std::vector<Box::index_run>& region_index( const std::string& region_name, int region_value );
     void handle_operation(const DeckKeyword& keyword, Box box);
     void handle_region_operation(const DeckKeyword& keyword);
     void handle_COPY(const DeckKeyword& keyword, Box box, bool region);
     void distribute_toplayer(FieldProps::FieldData<double>& field_data, const std::vector<double>& deck_data, const Box& box);
 
+    /*
+      Plain data keywords, i.e. keywords which just assign (or in EDIT
+      multiply) values from the deck in the current box, are queued and
+      the pending keywords are processed concurrently. The queue is
+      flushed before any other keyword, before a keyword which is
+      already pending and before a keyword whose initialization reads
+      other arrays.
+    */
+    struct DataKeyword {
+        const DeckKeyword* keyword;
+        bool int_keyword;
+    };
+
     void handle_keyword(const DeckKeyword& keyword, Box& box);
     void handle_double_keyword(Section section, const DeckKeyword& keyword, const Box& box);
     void handle_int_keyword(const DeckKeyword& keyword, const Box& box);
+    void load_double_keyword(Section section, const DeckKeyword& keyword, FieldData<double>& field_data, const Box& box);
+    void queue_data_keyword(Section section, std::vector<DataKeyword>& queue, const DeckKeyword& keyword, bool int_keyword, const Box& box);
+    void handle_data_keywords(Section section, std::vector<DataKeyword>& queue, const Box& box);
     void init_satfunc(const std::string& keyword, FieldData<double>& satfunc);
     void init_porv(FieldData<double>& porv);
     void init_tempi(FieldData<double>& tempi);
@@ -363,6 +387,7 @@ private:
     std::vector<MultregpRecord> multregp;
     std::unordered_map<std::string, FieldData<int>> int_data;
     std::unordered_map<std::string, FieldData<double>> double_data;
+    std::unordered_map<std::string, std::unordered_map<int, std::vector<Box::index_run>>> region_cache;
 };
 
 }
@@ -70,6 +70,14 @@ bool FieldPropsManager::supported(const std::string& keyword) {
     return FieldProps::supported<T>(keyword);
 }
 
+void FieldPropsManager::set_threads(int num_threads) {
+    FieldProps::set_threads(num_threads);
+}
+
+int FieldPropsManager::threads() {
+    return FieldProps::threads();
+}
+
 template <typename T>
 bool FieldPropsManager::has(const std::string& keyword) const {
     if (!this->fp->has<T>(keyword))
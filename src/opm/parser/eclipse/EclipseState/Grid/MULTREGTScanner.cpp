@@ -16,6 +16,8 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <algorithm>
+#include <cstdlib>
 #include <stdexcept>
 #include <map>
 #include <set>
@@ -125,6 +127,7 @@ std::vector<int> unique(const std::vector<int> data) {
         for (size_t idx = 0; idx < keywords.size(); idx++)
             this->addKeyword(*keywords[idx] , this->default_region);
 
+        std::map<std::string, std::vector<int>> regions;
         MULTREGTSearchMap searchPairs;
         for (std::vector<MULTREGTRecord>::const_iterator record = m_records.begin(); record != m_records.end(); ++record) {
             const std::string& region_name = record->region_name;
@@ -152,26 +155,77 @@ std::vector<int> unique(const std::vector<int> data) {
                                 + " which is not in the deck");
 
 #ifdef ENABLE_3DPROPS_TESTING
-            if (this->regions.count(region_name) == 0)
-                this->regions[region_name] = this->fp.get_global<int>(region_name);
+            if (regions.count(region_name) == 0)
+                regions[region_name] = this->fp.get_global<int>(region_name);
 #else
-            if (this->regions.count(region_name) == 0)
-                this->regions[region_name] = this->m_e3DProps.getIntGridProperty(region_name).getData();
+            if (regions.count(region_name) == 0)
+                regions[region_name] = this->m_e3DProps.getIntGridProperty(region_name).getData();
 #endif
         }
 
+        std::map<std::string , MULTREGTSearchMap> searchMap;
         for (auto iter = searchPairs.begin(); iter != searchPairs.end(); ++iter) {
             const MULTREGTRecord * record = (*iter).second;
             std::pair<int,int> pair = (*iter).first;
             const std::string& keyword = record->region_name;
-            if (m_searchMap.count(keyword) == 0)
-                m_searchMap[keyword] = MULTREGTSearchMap();
+            searchMap[keyword][pair] = record;
+        }
+
+        /*
+          Flatten the search maps to dense tables. The region arrays are
+          visited in the same (alphabetical) order as the maps, which
+          decides which record is used if several region arrays match.
+        */
+        for (const auto& search_pair : searchMap) {
+            const auto& map = search_pair.second;
+            RegionLookup lookup;
+            lookup.region_name = search_pair.first;
+            lookup.region_data = std::move(regions.at(search_pair.first));
+
+            int max_region = -1;
+            for (const auto& map_pair : map)
+                max_region = std::max({max_region, map_pair.first.first, map_pair.first.second});
+
+            lookup.slot.assign(max_region + 1, -1);
+            for (const auto& map_pair : map) {
+                for (int region : {map_pair.first.first, map_pair.first.second}) {
+                    if (region >= 0 && lookup.slot[region] < 0)
+                        lookup.slot[region] = lookup.num_slots++;
+                }
+            }
+
+            lookup.table.assign(lookup.num_slots * lookup.num_slots, -1);
+            for (const auto& map_pair : map) {
+                int region1 = map_pair.first.first;
+                int region2 = map_pair.first.second;
+                if (region1 < 0 || region2 < 0)
+                    continue;
+
+                std::size_t table_index = lookup.slot[region1] * lookup.num_slots + lookup.slot[region2];
+                lookup.table[table_index] = static_cast<int>(map_pair.second - this->m_records.data());
+            }
 
-            m_searchMap[keyword][pair] = record;
+            this->m_lookup.push_back(std::move(lookup));
         }
     }
 
 
+    int MULTREGTScanner::RegionLookup::record(int region1, int region2) const {
+        if (region1 < 0 || region2 < 0)
+            return -1;
+
+        if (static_cast<std::size_t>(region1) >= this->slot.size() || static_cast<std::size_t>(region2) >= this->slot.size())
+            return -1;
+
+        int slot1 = this->slot[region1];
+        int slot2 = this->slot[region2];
+        if (slot1 < 0 || slot2 < 0)
+            return -1;
+
+        return this->table[slot1 * this->num_slots + slot2];
+    }
+
+
     void MULTREGTScanner::assertKeywordSupported( const DeckKeyword& deckKeyword) {
         for (const auto& deckRecord : deckKeyword) {
             const auto& srcItem = deckRecord.getItem("SRC_REGION");
@@ -261,21 +315,25 @@ std::vector<int> unique(const std::vector<int> data) {
 
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
+        return this->multiplier(globalIndex1, globalIndex2, faceDir);
+    }
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            const auto& region_data = this->regions.at( iter->first );
-            const MULTREGTSearchMap& map = (*iter).second;
+
+    double MULTREGTScanner::multiplier(std::size_t globalIndex1, std::size_t globalIndex2, FaceDir::DirEnum faceDir) const {
+
+        for (const auto& lookup : this->m_lookup) {
+            const auto& region_data = lookup.region_data;
 
             int regionId1 = region_data[globalIndex1];
             int regionId2 = region_data[globalIndex2];
 
-            std::pair<int,int> pair{ regionId1, regionId2 };
-            if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir))
+            int record_index = lookup.record(regionId1, regionId2);
+            if (record_index < 0 || !(this->m_records[record_index].directions & faceDir)) {
+                record_index = lookup.record(regionId2, regionId1);
+                if (record_index < 0 || !(this->m_records[record_index].directions & faceDir))
                     continue;
             }
-            const MULTREGTRecord* record = map.at(pair);
+            const MULTREGTRecord* record = &this->m_records[record_index];
 
             bool applyMultiplier = true;
             int i1 = globalIndex1 % this->nx;
@@ -300,4 +358,34 @@ std::vector<int> unique(const std::vector<int> data) {
         }
         return 1;
     }
+
+
+    std::array<std::vector<double>, 3> MULTREGTScanner::getFaceMultipliers() const {
+        const std::size_t num_cells = this->nx * this->ny * this->nz;
+        std::array<std::vector<double>, 3> face_mult;
+        for (auto& mult : face_mult)
+            mult.assign(num_cells, 1.0);
+
+        if (this->m_lookup.empty())
+            return face_mult;
+
+        for (std::size_t k = 0; k < this->nz; k++) {
+            for (std::size_t j = 0; j < this->ny; j++) {
+                for (std::size_t i = 0; i < this->nx; i++) {
+                    std::size_t g = i + j * this->nx + k * this->nx * this->ny;
+
+                    if (i + 1 < this->nx)
+                        face_mult[0][g] = this->multiplier(g, g + 1, FaceDir::XPlus);
+
+                    if (j + 1 < this->ny)
+                        face_mult[1][g] = this->multiplier(g, g + this->nx, FaceDir::YPlus);
+
+                    if (k + 1 < this->nz)
+                        face_mult[2][g] = this->multiplier(g, g + this->nx * this->ny, FaceDir::ZPlus);
+                }
+            }
+        }
+
+        return face_mult;
+    }
 }
@@ -96,6 +96,10 @@ R"(This deck has the MULTREGT keyword located in the EDIT section. Note that:
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    std::array<std::vector<double>, 3> TransMult::getRegionFaceMultipliers() const {
+        return m_multregtScanner.getFaceMultipliers();
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
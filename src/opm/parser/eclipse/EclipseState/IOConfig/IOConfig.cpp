@@ -97,7 +97,8 @@ namespace Opm {
                        const std::string& output_dir,
                        bool no_sim,
                        const std::string& base_name,
-                       bool ecl_compatible_r) :
+                       bool ecl_compatible_r,
+                       bool columnar_summary) :
         m_write_INIT_file(write_init),
         m_write_EGRID_file(write_egrid),
         m_UNIFIN(unifin),
@@ -110,7 +111,8 @@ namespace Opm {
         m_output_dir(output_dir),
         m_nosim(no_sim),
         m_base_name(base_name),
-        ecl_compatible_rst(ecl_compatible_r)
+        ecl_compatible_rst(ecl_compatible_r),
+        m_columnar_summary(columnar_summary)
     {
     }
 
@@ -190,6 +192,16 @@ namespace Opm {
     }
 
 
+    bool IOConfig::getColumnarSummary() const {
+        return this->m_columnar_summary;
+    }
+
+
+    void IOConfig::setColumnarSummary(bool columnar) {
+        this->m_columnar_summary = columnar;
+    }
+
+
     void IOConfig::overrideNOSIM(bool nosim) {
         m_nosim = nosim;
     }
@@ -311,7 +323,8 @@ namespace Opm {
                this->getOutputDir() == data.getOutputDir() &&
                this->getNoSim() == data.getNoSim() &&
                this->getBaseName() == data.getBaseName() &&
-               this->getEclCompatibleRST() == data.getEclCompatibleRST();
+               this->getEclCompatibleRST() == data.getEclCompatibleRST() &&
+               this->getColumnarSummary() == data.getColumnarSummary();
     }
 
 
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <stdexcept>
 #include <fnmatch.h>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.hpp>
@@ -1,5 +1,6 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.hpp>
 
+#include <stdexcept>
 
 namespace Opm {
 namespace Action {
@@ -55,6 +55,8 @@ namespace Opm {
        , m_segments(segments)
        , segment_number_to_index(segmentNumberIdx)
     {
+        for (const auto& pair : segmentNumberIdx)
+            this->setSegmentIndex(pair.first, pair.second);
     }
 
     const std::string& WellSegments::wellName() const {
@@ -92,12 +94,25 @@ namespace Opm {
     }
 
     int WellSegments::segmentNumberToIndex(const int segment_number) const {
-        const auto it = segment_number_to_index.find(segment_number);
-        if (it != segment_number_to_index.end()) {
-            return it->second;
-        } else {
+        if (segment_number < 0 || static_cast<std::size_t>(segment_number) >= this->segment_lookup.size())
             return -1;
-        }
+
+        return this->segment_lookup[segment_number];
+    }
+
+    void WellSegments::setSegmentIndex(const int segment_number, const int index) {
+        if (segment_number < 0)
+            throw std::invalid_argument("Invalid segment number " + std::to_string(segment_number));
+
+        segment_number_to_index[segment_number] = index;
+        if (static_cast<std::size_t>(segment_number) >= this->segment_lookup.size())
+            this->segment_lookup.resize(segment_number + 1, -1);
+        this->segment_lookup[segment_number] = index;
+    }
+
+    void WellSegments::clearSegmentIndex() {
+        segment_number_to_index.clear();
+        this->segment_lookup.clear();
     }
 
     void WellSegments::addSegment( Segment new_segment ) {
@@ -107,7 +122,7 @@ namespace Opm {
        const int segment_index = segmentNumberToIndex(segment_number);
 
        if (segment_index < 0) { // it is a new segment
-           segment_number_to_index[segment_number] = size();
+           this->setSegmentIndex(segment_number, size());
            m_segments.push_back(new_segment);
        } else { // the segment already exists
            m_segments[segment_index] = new_segment;
@@ -219,7 +234,7 @@ namespace Opm {
             if (index >= 0) { // found in the existing m_segments already
                 throw std::logic_error("Segments with same segment number are found!\n");
             }
-            segment_number_to_index[segment_number] = i_segment;
+            this->setSegmentIndex(segment_number, i_segment);
         }
 
         for (size_t i_segment = 0; i_segment < m_segments.size(); ++i_segment) {
@@ -228,7 +243,10 @@ namespace Opm {
             if (outlet_segment <= 0) { // no outlet segment
                 continue;
             }
-            const int outlet_segment_index = segment_number_to_index[outlet_segment];
+            const int outlet_segment_index = segmentNumberToIndex(outlet_segment);
+            if (outlet_segment_index < 0)
+                throw std::logic_error("The outlet segment " + std::to_string(outlet_segment) + " of segment "
+                                       + std::to_string(segment_number) + " is not defined in WELSEGS");
             m_segments[outlet_segment_index].addInletSegment(segment_number);
         }
 
@@ -376,9 +394,9 @@ namespace Opm {
         int current_index= 1;
 
         // clear the mapping from segment number to store index
-        segment_number_to_index.clear();
+        this->clearSegmentIndex();
         // for the top segment
-        segment_number_to_index[1] = 0;
+        this->setSegmentIndex(1, 0);
 
         while (current_index< size()) {
             // the branch number of the last segment that is done re-ordering
@@ -416,7 +434,7 @@ namespace Opm {
                 std::swap(m_segments[current_index], m_segments[target_segment_index]);
             }
             const int segment_number = m_segments[current_index].segmentNumber();
-            segment_number_to_index[segment_number] = current_index;
+            this->setSegmentIndex(segment_number, current_index);
             current_index++;
         }
     }
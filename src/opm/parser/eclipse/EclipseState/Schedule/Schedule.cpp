@@ -17,7 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <exception>
 #include <fnmatch.h>
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -76,12 +78,57 @@ namespace Opm {
 
 namespace {
 
+    int schedule_threads = 1;
+
     bool name_match(const std::string& pattern, const std::string& name) {
         int flags = 0;
         return (fnmatch(pattern.c_str(), name.c_str(), flags) == 0);
     }
 
 
+    /*
+      A shell wildcard pattern for well names. The common form of a fixed
+      prefix followed by one trailing '*', like 'OP*', is recognized when the
+      pattern is created and can then be resolved as a range in the sorted
+      well name index; all other patterns are matched with fnmatch().
+    */
+    class NamePattern {
+    public:
+        explicit NamePattern(const std::string& pattern) :
+            m_pattern(pattern)
+        {
+            const auto special = pattern.find_first_of("*?[\\");
+            this->m_prefix_pattern = (special == pattern.size() - 1);
+            if (this->m_prefix_pattern)
+                this->m_prefix = pattern.substr(0, special);
+        }
+
+        bool prefixPattern() const {
+            return this->m_prefix_pattern;
+        }
+
+        const std::string& prefix() const {
+            return this->m_prefix;
+        }
+
+        bool prefixMatch(const std::string& name) const {
+            return name.compare(0, this->m_prefix.size(), this->m_prefix) == 0;
+        }
+
+        bool match(const std::string& name) const {
+            if (this->m_prefix_pattern)
+                return this->prefixMatch(name);
+
+            return name_match(this->m_pattern, name);
+        }
+
+    private:
+        std::string m_pattern;
+        std::string m_prefix;
+        bool m_prefix_pattern;
+    };
+
+
     /*
       The function trim_wgname() is used to trim the leading and trailing spaces
       away from the group and well arguments given in the WELSPECS and GRUPTREE
@@ -252,10 +299,23 @@ namespace {
         rft_config(rftconfig),
         m_nupcol(nupCol),
         wellgroup_events(wellGroupEvents)
-    {}
+    {
+        std::size_t index = 0;
+        for (const auto& well_pair : this->wells_static)
+            this->well_name_index.emplace(well_pair.first, index++);
+    }
 
 
 
+    void Schedule::setThreads(int num_threads) {
+        schedule_threads = std::max(1, num_threads);
+    }
+
+    int Schedule::threads() {
+        return schedule_threads;
+    }
+
+
     std::time_t Schedule::getStartTime() const {
         return this->posixStartTime( );
     }
@@ -487,9 +547,34 @@ namespace {
         std::vector<std::pair< const DeckKeyword* , size_t> > rftProperties;
         size_t keywordIdx = 0;
 
+        /*
+          With more than one thread the COMPDAT keywords, and the COMPLUMP
+          and WPIMULT keywords following them, are collected until the next
+          keyword of another kind; that is always within one report step.
+          The collected keywords are then processed as one keyword stream per
+          well in handleWellStreams().
+        */
+        std::vector<const DeckKeyword*> well_keywords;
+        auto well_stream_keyword = [&well_keywords](const DeckKeyword& keyword) {
+            if (schedule_threads == 1)
+                return false;
+
+            if (keyword.name() == "COMPDAT")
+                return true;
+
+            return !well_keywords.empty() && (keyword.name() == "COMPLUMP" || keyword.name() == "WPIMULT");
+        };
+
         while (true) {
             const auto& keyword = section.getKeyword(keywordIdx);
-            if (keyword.name() == "ACTIONX") {
+            if (well_stream_keyword(keyword))
+                well_keywords.push_back(&keyword);
+            else if (!well_keywords.empty()) {
+                // Process the collected keywords, and then revisit this keyword.
+                this->handleWellStreams(well_keywords, currentStep, grid, fp, eclipseProperties, parseContext, errors);
+                well_keywords.clear();
+                continue;
+            } else if (keyword.name() == "ACTIONX") {
                 Action::ActionX action(keyword, this->m_timeMap.getStartTime(currentStep + 1));
                 while (true) {
                     keywordIdx++;
@@ -516,6 +601,9 @@ namespace {
                 break;
         }
 
+        if (!well_keywords.empty())
+            this->handleWellStreams(well_keywords, currentStep, grid, fp, eclipseProperties, parseContext, errors);
+
         checkIfAllConnectionsIsShut(currentStep);
 
         for (auto rftPair = rftProperties.begin(); rftPair != rftProperties.end(); ++rftPair) {
@@ -1934,62 +2022,134 @@ namespace {
         }
     }
 
-#ifdef ENABLE_3DPROPS_TESTING
-    void Schedule::handleCOMPDAT( const DeckKeyword& keyword, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties&, const ParseContext& parseContext, ErrorGuard& errors) {
-#else
-    void Schedule::handleCOMPDAT( const DeckKeyword& keyword, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& , const Eclipse3DProperties& eclipseProperties, const ParseContext& parseContext, ErrorGuard& errors) {
-#endif
-        for (const auto& record : keyword) {
-            const std::string& wellNamePattern = record.getItem("WELL").getTrimmedString(0);
-            auto wellnames = this->wellNames(wellNamePattern, currentStep);
-            if (wellnames.empty())
-                invalidNamePattern(wellNamePattern, parseContext, errors, keyword);
+    void Schedule::handleCOMPDAT( const DeckKeyword& keyword, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties& eclipseProperties, const ParseContext& parseContext, ErrorGuard& errors) {
+        this->handleWellStreams({&keyword}, currentStep, grid, fp, eclipseProperties, parseContext, errors);
+    }
 
-            for (const auto& name : wellnames) {
-                {
-                    auto well2 = std::shared_ptr<Well>(new Well( this->getWell(name, currentStep)));
-                    auto connections = std::shared_ptr<WellConnections>( new WellConnections( well2->getConnections()));
+
+    /*
+      The keywords are one or more COMPDAT keywords of one report step, and
+      possibly COMPLUMP and WPIMULT keywords following them. These keywords
+      only change the connections of the wells they name, so the records
+      are partitioned into one stream per well, in order of first
+      appearance, and the records of each stream are applied in deck order.
+      With Schedule::threads() > 1 the streams are processed concurrently.
+      The properties below are fetched once up front, and the updated wells
+      and the events are stored afterwards in the original well order.
+    */
 #ifdef ENABLE_3DPROPS_TESTING
-                    connections->loadCOMPDAT(record, grid, fp);
+    void Schedule::handleWellStreams( const std::vector<const DeckKeyword*>& keywords, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& fp, const Eclipse3DProperties&, const ParseContext& parseContext, ErrorGuard& errors) {
+        const auto permx = fp.try_get<double>("PERMX");
+        const auto permy = fp.try_get<double>("PERMY");
+        const auto permz = fp.try_get<double>("PERMZ");
+        const auto& ntg = fp.get<double>("NTG");
+        const auto& satnum = fp.get<int>("SATNUM");
 #else
-                    connections->loadCOMPDAT(record, grid, eclipseProperties);
+    void Schedule::handleWellStreams( const std::vector<const DeckKeyword*>& keywords, size_t currentStep, const EclipseGrid& grid, const FieldPropsManager& , const Eclipse3DProperties& eclipseProperties, const ParseContext& parseContext, ErrorGuard& errors) {
+        const auto permx_data = eclipseProperties.getDoubleGridProperty("PERMX").compressedCopy(grid);
+        const auto permy_data = eclipseProperties.getDoubleGridProperty("PERMY").compressedCopy(grid);
+        const auto permz_data = eclipseProperties.getDoubleGridProperty("PERMZ").compressedCopy(grid);
+        const auto ntg = eclipseProperties.getDoubleGridProperty("NTG").compressedCopy(grid);
+        const auto satnum = eclipseProperties.getIntGridProperty("SATNUM").compressedCopy(grid);
+        const auto permx = std::addressof(permx_data);
+        const auto permy = std::addressof(permy_data);
+        const auto permz = std::addressof(permz_data);
 #endif
-                    /*
-                      This block implements the following dubious logic.
-
-                        1. All competions are shut.
-                        2. A new open completion is added.
-                        3. A currently SHUT well is opened.
-
-                      This code assumes that the reason the well is initially
-                      shut is due to all the shut completions, if the well was
-                      explicitly shut for another reason the explicit opening of
-                      the well might be in error?
-                    */
-                    /*if (all_shut0) {
-                        if (!connections->allConnectionsShut()) {
-                            if (well2->getStatus() == WellCommon::StatusEnum::SHUT) {
-                                printf("Running all_shut inner loop\n");
-                                if (this->updateWellStatus(well2->name(), currentStep, WellCommon::StatusEnum::OPEN))
-                                    // Refresh pointer if the status has updated current slot. Ugly
-                                    well2 = std::shared_ptr<Well>(new Well(this->getWell(name, currentStep)));
-                            }
-                        }
-                    }
-                    */
-                    if (well2->updateConnections(connections))
-                        this->updateWell(well2, currentStep);
+        struct WellStream {
+            std::string name;
+            std::vector<std::pair<const DeckKeyword*, const DeckRecord*>> records;
+            bool compdat = false;
+        };
 
-                    if (well2->getStatus() == Well::Status::SHUT) {
-                        std::string msg =
-                            "All completions in well " + well2->name() + " is shut at " + std::to_string ( m_timeMap.getTimePassedUntil(currentStep) / (60*60*24) ) + " days. \n" +
-                            "The well is therefore also shut.";
-                        OpmLog::note(msg);
+        std::vector<WellStream> streams;
+        std::map<std::string, std::size_t> well_index;
+        for (const auto * keyword : keywords) {
+            const bool compdat = (keyword->name() == "COMPDAT");
+            for (const auto& record : *keyword) {
+                const std::string& wellNamePattern = record.getItem("WELL").getTrimmedString(0);
+                auto wellnames = this->wellNames(wellNamePattern, currentStep);
+                if (compdat && wellnames.empty())
+                    invalidNamePattern(wellNamePattern, parseContext, errors, *keyword);
+
+                for (const auto& name : wellnames) {
+                    auto index_iter = well_index.find(name);
+                    if (index_iter == well_index.end()) {
+                        index_iter = well_index.emplace(name, streams.size()).first;
+                        streams.push_back({name, {}, false});
                     }
+                    auto& stream = streams[index_iter->second];
+                    stream.records.emplace_back(keyword, &record);
+                    stream.compdat |= compdat;
+                }
+            }
+        }
+
+        /*
+          DeckItem converts its data to SI units in place on first use, and
+          a record can apply to several wells, e.g. with the pattern 'W*'.
+          The conversion is therefore done here, serially, so the tasks
+          below only read the items.
+        */
+        for (const auto * keyword : keywords) {
+            for (const auto& record : *keyword) {
+                for (const auto& item : record) {
+                    if (item.getType() == type_tag::fdouble && !item.activeDimensions().empty())
+                        item.getSIDoubleData();
+                }
+            }
+        }
+
+        const long num_wells = streams.size();
+        std::vector<std::shared_ptr<Well>> wells(num_wells);
+        std::vector<int> well_updated(num_wells, 0);
+        std::vector<std::exception_ptr> well_errors(num_wells);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(schedule_threads) if(schedule_threads > 1 && num_wells > 1)
+#endif
+        for (long index = 0; index < num_wells; index++) {
+            try {
+                auto well2 = std::make_shared<Well>( this->getWell(streams[index].name, currentStep));
+                for (const auto& keyword_record : streams[index].records) {
+                    const auto& keyword_name = keyword_record.first->name();
+                    const auto& record = *keyword_record.second;
+                    bool update = false;
+                    if (keyword_name == "COMPDAT") {
+                        auto connections = std::make_shared<WellConnections>( well2->getConnections());
+                        connections->loadCOMPDAT(record, grid, satnum, permx, permy, permz, ntg);
+                        update = well2->updateConnections(connections);
+                    } else if (keyword_name == "COMPLUMP")
+                        update = well2->handleCOMPLUMP(record);
+                    else if (keyword_name == "WPIMULT")
+                        update = well2->handleWPIMULT(record);
+
+                    if (update)
+                        well_updated[index] = 1;
                 }
-                this->addWellGroupEvent(name, ScheduleEvents::COMPLETION_CHANGE, currentStep);
+                wells[index] = well2;
+            } catch (...) {
+                well_errors[index] = std::current_exception();
             }
         }
+
+        for (long index = 0; index < num_wells; index++) {
+            if (well_errors[index])
+                std::rethrow_exception(well_errors[index]);
+
+            const auto& well2 = wells[index];
+            if (well_updated[index])
+                this->updateWell(well2, currentStep);
+
+            if (!streams[index].compdat)
+                continue;
+
+            if (well2->getStatus() == Well::Status::SHUT) {
+                std::string msg =
+                    "All completions in well " + well2->name() + " is shut at " + std::to_string ( m_timeMap.getTimePassedUntil(currentStep) / (60*60*24) ) + " days. \n" +
+                    "The well is therefore also shut.";
+                OpmLog::note(msg);
+            }
+            this->addWellGroupEvent(well2->name(), ScheduleEvents::COMPLETION_CHANGE, currentStep);
+        }
         m_events.addEvent(ScheduleEvents::COMPLETION_CHANGE, currentStep);
     }
 
@@ -2233,6 +2393,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         }
         {
             wells_static.insert( std::make_pair(wellName, DynamicState<std::shared_ptr<Well>>(m_timeMap, nullptr)));
+            this->well_name_index.emplace(wellName, this->wells_static.size() - 1);
 
             auto& dynamic_state = wells_static.at(wellName);
             const std::string& group = record.getItem<ParserKeywords::WELSPECS::GROUP>().getTrimmedString(0);
@@ -2298,22 +2459,36 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
 
 
     std::vector< Well > Schedule::getChildWells2(const std::string& group_name, size_t timeStep) const {
+        std::vector<Well> wells;
+        for (const auto* well_ptr : this->getChildWellPtrs(group_name, timeStep))
+            wells.push_back(*well_ptr);
+
+        return wells;
+    }
+
+
+    /*
+      The pointers returned by getChildWellPtrs() and getWellPtrs() refer to
+      the Well objects held by the Schedule; they go stale if the wells are
+      subsequently updated, e.g. through updateWell() or updateWellStatus().
+    */
+    std::vector<const Well*> Schedule::getChildWellPtrs(const std::string& group_name, size_t timeStep) const {
         if (!hasGroup(group_name))
             throw std::invalid_argument("No such group: '" + group_name + "'");
         {
             const auto& dynamic_state = this->groups.at(group_name);
             const auto& group_ptr = dynamic_state.get(timeStep);
             if (group_ptr) {
-                std::vector<Well> wells;
+                std::vector<const Well*> wells;
 
                 if (group_ptr->groups().size()) {
                     for (const auto& child_name : group_ptr->groups()) {
-                        const auto& child_wells = getChildWells2( child_name, timeStep);
+                        const auto& child_wells = getChildWellPtrs( child_name, timeStep);
                         wells.insert( wells.end() , child_wells.begin() , child_wells.end());
                     }
                 } else {
                     for (const auto& well_name : group_ptr->wells( ))
-                        wells.push_back( this->getWell( well_name, timeStep ));
+                        wells.push_back( std::addressof(this->getWell( well_name, timeStep )));
                 }
 
                 return wells;
@@ -2326,13 +2501,22 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
 
     std::vector<Well> Schedule::getWells(size_t timeStep) const {
         std::vector<Well> wells;
+        for (const auto* well_ptr : this->getWellPtrs(timeStep))
+            wells.push_back(*well_ptr);
+
+        return wells;
+    }
+
+    std::vector<const Well*> Schedule::getWellPtrs(size_t timeStep) const {
+        std::vector<const Well*> wells;
         if (timeStep >= this->m_timeMap.size())
             throw std::invalid_argument("timeStep argument beyond the length of the simulation");
 
+        wells.reserve(this->wells_static.size());
         for (const auto& dynamic_pair : this->wells_static) {
             auto& well_ptr = dynamic_pair.second.get(timeStep);
             if (well_ptr)
-                wells.push_back(*well_ptr.get());
+                wells.push_back(well_ptr.get());
         }
         return wells;
     }
@@ -2407,13 +2591,29 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
-            std::vector<std::string> names;
-            for (const auto& well_pair : this->wells_static) {
-                if (name_match(pattern, well_pair.first)) {
-                    const auto& dynamic_state = well_pair.second;
-                    if (dynamic_state.get(timeStep))
-                        names.push_back(well_pair.first);
+            const NamePattern name_pattern(pattern);
+            std::vector<std::size_t> well_index;
+            if (name_pattern.prefixPattern()) {
+                auto iter = this->well_name_index.lower_bound(name_pattern.prefix());
+                while (iter != this->well_name_index.end() && name_pattern.prefixMatch(iter->first)) {
+                    well_index.push_back(iter->second);
+                    ++iter;
                 }
+                std::sort(well_index.begin(), well_index.end());
+            } else {
+                for (std::size_t index = 0; index < this->wells_static.size(); index++) {
+                    const auto& well_pair = *(this->wells_static.begin() + index);
+                    if (name_pattern.match(well_pair.first))
+                        well_index.push_back(index);
+                }
+            }
+
+            std::vector<std::string> names;
+            for (const auto& index : well_index) {
+                const auto& well_pair = *(this->wells_static.begin() + index);
+                const auto& dynamic_state = well_pair.second;
+                if (dynamic_state.get(timeStep))
+                    names.push_back(well_pair.first);
             }
             return names;
         }
@@ -2678,27 +2878,12 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
 
 
     void Schedule::filterConnections(const ActiveGridCells& grid) {
+        Well::FilteredConnections filtered;
         for (auto& dynamic_pair : this->wells_static) {
             auto& dynamic_state = dynamic_pair.second;
             for (auto& well_pair : dynamic_state.unique()) {
                 if (well_pair.second)
-                    well_pair.second->filterConnections(grid);
-            }
-        }
-
-        for (auto& dynamic_pair : this->wells_static) {
-            auto& dynamic_state = dynamic_pair.second;
-            for (auto& well_pair : dynamic_state.unique()) {
-                if (well_pair.second)
-                    well_pair.second->filterConnections(grid);
-            }
-        }
-
-        for (auto& dynamic_pair : this->wells_static) {
-            auto& dynamic_state = dynamic_pair.second;
-            for (auto& well_pair : dynamic_state.unique()) {
-                if (well_pair.second)
-                    well_pair.second->filterConnections(grid);
+                    well_pair.second->filterConnections(grid, filtered);
             }
         }
     }
@@ -2911,10 +3096,12 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         };
 
         auto&& compareDynState = [comparePtr](const auto& state1, const auto& state2) {
-            if (state1.data().size() != state2.data().size())
+            const auto data1 = state1.data();
+            const auto data2 = state2.data();
+            if (data1.size() != data2.size())
                 return false;
-            return std::equal(state1.data().begin(), state1.data().end(),
-                              state2.data().begin(), comparePtr);
+            return std::equal(data1.begin(), data1.end(),
+                              data2.begin(), comparePtr);
         };
 
         auto&& compareMap = [comparePtr,
@@ -17,11 +17,13 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <atomic>
 #include <unordered_map>
 #include <cstring>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 
@@ -51,8 +53,34 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
+    std::size_t next_layout_id() {
+        static std::atomic<std::size_t> counter{0};
+        return ++counter;
+    }
+
 }
 
+    SummaryState::LayoutId::LayoutId() :
+        value(next_layout_id())
+    {}
+
+
+    SummaryState::LayoutId::LayoutId(const LayoutId&) :
+        value(next_layout_id())
+    {}
+
+
+    SummaryState::LayoutId& SummaryState::LayoutId::operator=(const LayoutId&) {
+        this->renew();
+        return *this;
+    }
+
+
+    void SummaryState::LayoutId::renew() {
+        this->value = next_layout_id();
+    }
+
+
     SummaryState::SummaryState(std::chrono::system_clock::time_point sim_start_arg):
         sim_start(sim_start_arg)
     {
@@ -80,55 +108,149 @@ namespace {
     }
 
 
-    void SummaryState::update(const std::string& key, double value) {
-        if (is_total(key))
-            this->values[key] += value;
+    std::size_t SummaryState::new_slot(const std::string& key, SlotType type, const std::string& entity, bool total) {
+        const auto slot = this->slot_keys.size();
+        this->slot_keys.push_back(key);
+        this->slot_values.push_back(0);
+        this->slot_defined.push_back(false);
+        this->slot_total.push_back(total);
+        this->slot_type.push_back(type);
+        this->slot_entity.push_back(entity);
+        this->slot_general.push_back(slot);
+        return slot;
+    }
+
+
+    std::size_t SummaryState::slot(const std::string& key) {
+        const auto iter = this->slot_index.find(key);
+        if (iter != this->slot_index.end())
+            return iter->second;
+
+        const auto slot = this->new_slot(key, SlotType::Plain, "", is_total(key));
+        this->slot_index.emplace(key, slot);
+        return slot;
+    }
+
+
+    std::size_t SummaryState::entity_slot(SlotType type, const std::string& entity, const std::string& var) {
+        auto& var_slots = (type == SlotType::Well)
+            ? this->well_values[var]
+            : this->group_values[var];
+
+        const auto iter = var_slots.find(entity);
+        if (iter != var_slots.end())
+            return iter->second;
+
+        const auto key = var + ":" + entity;
+        const auto general = this->slot(key);
+        const auto slot = this->new_slot(key, type, entity, is_total(var));
+        this->slot_general[slot] = general;
+        var_slots.emplace(entity, slot);
+        return slot;
+    }
+
+
+    std::size_t SummaryState::well_slot(const std::string& well, const std::string& var) {
+        return this->entity_slot(SlotType::Well, well, var);
+    }
+
+
+    std::size_t SummaryState::group_slot(const std::string& group, const std::string& var) {
+        return this->entity_slot(SlotType::Group, group, var);
+    }
+
+
+    std::size_t SummaryState::find_slot(const std::string& key) const {
+        const auto iter = this->slot_index.find(key);
+        if (iter == this->slot_index.end())
+            return this->slot_keys.size();
+
+        return iter->second;
+    }
+
+
+    void SummaryState::assign_slot(std::size_t slot, double value) {
+        this->slot_values[slot] = value;
+        if (this->slot_defined[slot])
+            return;
+
+        this->slot_defined[slot] = true;
+        if (this->slot_type[slot] == SlotType::Plain)
+            this->num_defined += 1;
+        else if (this->slot_type[slot] == SlotType::Well)
+            this->m_wells.insert(this->slot_entity[slot]);
+        else
+            this->m_groups.insert(this->slot_entity[slot]);
+    }
+
+
+    void SummaryState::accumulate_slot(std::size_t slot, double value) {
+        if (this->slot_total[slot])
+            this->assign_slot(slot, this->slot_values[slot] + value);
         else
-            this->values[key] = value;
+            this->assign_slot(slot, value);
+    }
+
+
+    void SummaryState::update_slot(std::size_t slot, double value) {
+        this->accumulate_slot(slot, value);
+
+        const auto general = this->slot_general[slot];
+        if (general != slot)
+            this->accumulate_slot(general, value);
+    }
+
+
+    bool SummaryState::has_slot(std::size_t slot) const {
+        return this->slot_defined[slot];
+    }
+
+
+    double SummaryState::get_slot(std::size_t slot) const {
+        return this->slot_values[slot];
+    }
+
+
+    std::size_t SummaryState::num_slots() const {
+        return this->slot_keys.size();
+    }
+
+
+    std::size_t SummaryState::layout_id() const {
+        return this->layout.value;
+    }
+
+
+    void SummaryState::update(const std::string& key, double value) {
+        this->update_slot(this->slot(key), value);
     }
 
 
     void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
-        std::string key = var + ":" + group;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->group_values[var][group] += value;
-        } else {
-            this->values[key] = value;
-            this->group_values[var][group] = value;
-        }
-        this->m_groups.insert(group);
+        this->update_slot(this->group_slot(group, var), value);
     }
 
     void SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
-        std::string key = var + ":" + well;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->well_values[var][well] += value;
-        } else {
-            this->values[key] = value;
-            this->well_values[var][well] = value;
-        }
-        this->m_wells.insert(well);
+        this->update_slot(this->well_slot(well, var), value);
     }
 
 
     void SummaryState::set(const std::string& key, double value) {
-        this->values[key] = value;
+        this->assign_slot(this->slot(key), value);
     }
 
 
     bool SummaryState::has(const std::string& key) const {
-        return (this->values.find(key) != this->values.end());
+        const auto key_slot = this->find_slot(key);
+        return (key_slot < this->slot_keys.size()) && this->slot_defined[key_slot];
     }
 
 
     double SummaryState::get(const std::string& key) const {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        if (!this->has(key))
             throw std::out_of_range("No such key: " + key);
 
-        return iter->second;
+        return this->slot_values[this->find_slot(key)];
     }
 
     bool SummaryState::has_well_var(const std::string& well, const std::string& var) const {
@@ -140,11 +262,15 @@ namespace {
         if (well_iter == var_iter->second.end())
             return false;
 
-        return true;
+        return this->slot_defined[well_iter->second];
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var) const {
-        return this->well_values.at(var).at(well);
+        const auto well_slot = this->well_values.at(var).at(well);
+        if (!this->slot_defined[well_slot])
+            throw std::out_of_range("No value for well variable: " + var + ":" + well);
+
+        return this->slot_values[well_slot];
     }
 
     bool SummaryState::has_group_var(const std::string& group, const std::string& var) const {
@@ -156,20 +282,24 @@ namespace {
         if (group_iter == var_iter->second.end())
             return false;
 
-        return true;
+        return this->slot_defined[group_iter->second];
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var) const {
-        return this->group_values.at(var).at(group);
+        const auto group_slot = this->group_values.at(var).at(group);
+        if (!this->slot_defined[group_slot])
+            throw std::out_of_range("No value for group variable: " + var + ":" + group);
+
+        return this->slot_values[group_slot];
     }
 
     SummaryState::const_iterator SummaryState::begin() const {
-        return this->values.begin();
+        return const_iterator(*this, 0);
     }
 
 
     SummaryState::const_iterator SummaryState::end() const {
-        return this->values.end();
+        return const_iterator(*this, this->slot_keys.size());
     }
 
 
@@ -180,7 +310,8 @@ namespace {
 
         std::vector<std::string> wells;
         for (const auto& pair : var_iter->second)
-            wells.push_back(pair.first);
+            if (this->slot_defined[pair.second])
+                wells.push_back(pair.first);
         return wells;
     }
 
@@ -197,7 +328,8 @@ namespace {
 
         std::vector<std::string> groups;
         for (const auto& pair : var_iter->second)
-            groups.push_back(pair.first);
+            if (this->slot_defined[pair.second])
+                groups.push_back(pair.first);
         return groups;
     }
 
@@ -211,7 +343,76 @@ namespace {
     }
 
     std::size_t SummaryState::size() const {
-        return this->values.size();
+        return this->num_defined;
+    }
+
+
+    void SummaryState::clear() {
+        this->slot_index.clear();
+        this->slot_keys.clear();
+        this->slot_values.clear();
+        this->slot_defined.clear();
+        this->slot_total.clear();
+        this->slot_type.clear();
+        this->slot_entity.clear();
+        this->slot_general.clear();
+        this->num_defined = 0;
+        this->m_wells.clear();
+        this->well_values.clear();
+        this->m_groups.clear();
+        this->group_values.clear();
+        this->elapsed = 0;
+        this->layout.renew();
+    }
+
+
+    SummaryState::const_iterator::const_iterator(const SummaryState& st_arg, std::size_t slot_arg) :
+        st(&st_arg),
+        slot(slot_arg)
+    {
+        this->skip_undefined();
+    }
+
+
+    SummaryState::const_iterator::reference SummaryState::const_iterator::operator*() const {
+        return { this->st->slot_keys[this->slot], this->st->slot_values[this->slot] };
+    }
+
+
+    SummaryState::const_iterator::pointer SummaryState::const_iterator::operator->() const {
+        return pointer(**this);
+    }
+
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++() {
+        this->slot += 1;
+        this->skip_undefined();
+        return *this;
+    }
+
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int) {
+        auto prev = *this;
+        ++(*this);
+        return prev;
+    }
+
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& other) const {
+        return (this->st == other.st) && (this->slot == other.slot);
+    }
+
+
+    bool SummaryState::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+    }
+
+
+    void SummaryState::const_iterator::skip_undefined() {
+        const auto& slots = *this->st;
+        while ((this->slot < slots.slot_keys.size()) &&
+               !(slots.slot_defined[this->slot] && (slots.slot_type[this->slot] == SlotType::Plain)))
+            this->slot += 1;
     }
 
 
@@ -264,11 +465,21 @@ namespace {
         return {std::addressof(this->buffer[this->pos - length]), length};
     }
 
-    void put_map(Serializer& ser, const std::unordered_map<std::string, double>& values) {
-        ser.put(values.size());
-        for (const auto& value_pair : values) {
-            ser.put(value_pair.first);
-            ser.put(value_pair.second);
+    void put_map(Serializer& ser,
+                 const std::unordered_map<std::string, std::size_t>& slots,
+                 const std::vector<double>& values,
+                 const std::vector<char>& defined) {
+        std::size_t num_defined = 0;
+        for (const auto& slot_pair : slots)
+            num_defined += defined[slot_pair.second];
+
+        ser.put(num_defined);
+        for (const auto& slot_pair : slots) {
+            if (!defined[slot_pair.second])
+                continue;
+
+            ser.put(slot_pair.first);
+            ser.put(values[slot_pair.second]);
         }
     }
 
@@ -277,18 +488,18 @@ namespace {
     std::vector<char> SummaryState::serialize() const {
         Serializer ser;
         ser.put(this->elapsed);
-        put_map(ser, values);
+        put_map(ser, this->slot_index, this->slot_values, this->slot_defined);
 
         ser.put(this->well_values.size());
         for (const auto& well_var_pair : this->well_values) {
             ser.put(well_var_pair.first);
-            put_map(ser, well_var_pair.second);
+            put_map(ser, well_var_pair.second, this->slot_values, this->slot_defined);
         }
 
         ser.put(this->group_values.size());
         for (const auto& group_var_pair : this->group_values) {
             ser.put(group_var_pair.first);
-            put_map(ser, group_var_pair.second);
+            put_map(ser, group_var_pair.second, this->slot_values, this->slot_defined);
         }
 
         return std::move(ser.buffer);
@@ -296,12 +507,7 @@ namespace {
 
 
     void  SummaryState::deserialize(const std::vector<char>& buffer) {
-        this->values.clear();
-        this->m_wells.clear();
-        this->well_values.clear();
-        this->m_groups.clear();
-        this->group_values.clear();
-        this->elapsed = 0;
+        this->clear();
 
         Serializer ser(buffer);
         this->elapsed = ser.get<double>();
@@ -323,7 +529,7 @@ namespace {
                 for (std::size_t well_index=0; well_index < num_well; well_index++) {
                     std::string well = ser.get<std::string>();
                     double value = ser.get<double>();
-                    this->update_well_var(well, var, value);
+                    this->assign_slot(this->well_slot(well, var), value);
                 }
             }
         }
@@ -337,7 +543,7 @@ namespace {
                 for (std::size_t group_index=0; group_index < num_group; group_index++) {
                     std::string group = ser.get<std::string>();
                     double value = ser.get<double>();
-                    this->update_group_var(group, var, value);
+                    this->assign_slot(this->group_slot(group, var), value);
                 }
             }
         }
@@ -25,6 +25,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.hpp>
+#include <algorithm>
 #include <fnmatch.h>
 
 namespace Opm {
@@ -70,6 +71,31 @@ namespace {
         return (limit(rec,s,shift) == value);
     }
 
+
+    /*
+      Applies modify() to a copy of every connection. A new connection set
+      is only created when at least one connection is changed by modify(),
+      otherwise nullptr is returned and the well can keep the current set.
+    */
+    template <typename Modifier>
+    std::shared_ptr<WellConnections> modified_connections(const WellConnections& connections, int headI, int headJ, Modifier modify) {
+        const auto changed = [&modify](const Connection& c) {
+            auto new_connection = c;
+            modify(new_connection);
+            return !(new_connection == c);
+        };
+
+        if (std::none_of(connections.begin(), connections.end(), changed))
+            return nullptr;
+
+        auto new_connections = std::make_shared<WellConnections>(headI, headJ);
+        for (auto c : connections) {
+            modify(c);
+            new_connections->add(c);
+        }
+        return new_connections;
+    }
+
 }
 
 Well::Well() :
@@ -412,6 +438,9 @@ bool Well::updateAutoShutin(bool auto_shutin) {
 
 
 bool Well::updateConnections(const std::shared_ptr<WellConnections> connections_arg) {
+    if (connections_arg == this->connections)
+        return false;
+
     if( this->ordering  == Connection::Order::TRACK)
         connections_arg->orderConnections( this->headI, this->headJ );
 
@@ -631,19 +660,17 @@ bool Well::handleWELOPEN(const DeckRecord& record, Connection::State state_arg,
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>(this->headI, this->headJ);
-
-    for (auto c : *this->connections) {
-        if (match(c))
-            c.setState( state_arg );
-
-        new_connections->add(c);
-    }
+    auto new_connections = modified_connections(*this->connections, this->headI, this->headJ,
+                                                [&](Connection& c) { if (match(c)) c.setState( state_arg ); });
     if (action_mode) {
-        if (new_connections->allConnectionsShut())
+        const auto& connections_arg = new_connections ? *new_connections : *this->connections;
+        if (connections_arg.allConnectionsShut())
             this->status = Status::SHUT;
     }
 
+    if (!new_connections)
+        return false;
+
     return this->updateConnections(new_connections);
 }
 
@@ -658,17 +685,14 @@ bool Well::handleCOMPLUMP(const DeckRecord& record) {
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>(this->headI, this->headJ);
     const int complnum = record.getItem("N").get<int>(0);
     if (complnum <= 0)
         throw std::invalid_argument("Completion number must be >= 1. COMPLNUM=" + std::to_string(complnum) + "is invalid");
 
-    for (auto c : *this->connections) {
-        if (match(c))
-            c.setComplnum( complnum );
-
-        new_connections->add(c);
-    }
+    auto new_connections = modified_connections(*this->connections, this->headI, this->headJ,
+                                                [&](Connection& c) { if (match(c)) c.setComplnum( complnum ); });
+    if (!new_connections)
+        return false;
 
     return this->updateConnections(new_connections);
 }
@@ -687,15 +711,12 @@ bool Well::handleWPIMULT(const DeckRecord& record) {
         return true;
     };
 
-    auto new_connections = std::make_shared<WellConnections>(this->headI, this->headJ);
     double wellPi = record.getItem("WELLPI").get< double >(0);
 
-    for (auto c : *this->connections) {
-        if (match(c))
-            c.scaleWellPi( wellPi );
-
-        new_connections->add(c);
-    }
+    auto new_connections = modified_connections(*this->connections, this->headI, this->headJ,
+                                                [&](Connection& c) { if (match(c)) c.scaleWellPi( wellPi ); });
+    if (!new_connections)
+        return false;
 
     return this->updateConnections(new_connections);
 }
@@ -721,7 +742,7 @@ bool Well::handleWELSEGS(const DeckKeyword& keyword) {
 
 bool Well::updateWSEGSICD(const std::vector<std::pair<int, SpiralICD> >& sicd_pairs) {
     auto new_segments = std::make_shared<WellSegments>(*this->segments);
-    if (new_segments->updateWSEGSICD(sicd_pairs)) {
+    if (new_segments->updateWSEGSICD(sicd_pairs) && *new_segments != *this->segments) {
         this->segments = new_segments;
         return true;
     } else
@@ -731,7 +752,7 @@ bool Well::updateWSEGSICD(const std::vector<std::pair<int, SpiralICD> >& sicd_pa
 
 bool Well::updateWSEGVALV(const std::vector<std::pair<int, Valve> >& valve_pairs) {
     auto new_segments = std::make_shared<WellSegments>(*this->segments);
-    if (new_segments->updateWSEGVALV(valve_pairs)) {
+    if (new_segments->updateWSEGVALV(valve_pairs) && *new_segments != *this->segments) {
         this->segments = new_segments;
         return true;
     } else
@@ -739,7 +760,23 @@ bool Well::updateWSEGVALV(const std::vector<std::pair<int, Valve> >& valve_pairs
 }
 
 void Well::filterConnections(const ActiveGridCells& grid) {
-    this->connections->filter(grid);
+    FilteredConnections filtered;
+    this->filterConnections(grid, filtered);
+}
+
+void Well::filterConnections(const ActiveGridCells& grid, FilteredConnections& filtered) {
+    auto iter = filtered.find(this->connections);
+    if (iter == filtered.end()) {
+        const auto inactive = [&grid](const Connection& c) { return !grid.cellActive(c.getI(), c.getJ(), c.getK()); };
+        std::shared_ptr<const WellConnections> new_connections = this->connections;
+        if (std::any_of(this->connections->begin(), this->connections->end(), inactive)) {
+            auto filtered_connections = std::make_shared<WellConnections>(*this->connections);
+            filtered_connections->filter(grid);
+            new_connections = filtered_connections;
+        }
+        iter = filtered.emplace(this->connections, new_connections).first;
+    }
+    this->connections = iter->second;
 }
 
 
@@ -135,6 +135,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
         num_removed(numRemoved),
         m_connections(connections)
     {
+        this->buildIJKIndex();
     }
 
 
@@ -292,10 +293,6 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
             if (defaultSatTable)
                 satTableId = satnum_data[active_index];
 
-            auto same_ijk = [&]( const Connection& c ) {
-                return c.sameCoordinate( I,J,k );
-            };
-
             if (KhItem.hasValue(0) && KhItem.getSIDouble(0) > 0.0)
                 Kh = KhItem.getSIDouble(0);
 
@@ -341,10 +338,8 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
 
 
         CF_done:
-            auto prev = std::find_if( this->m_connections.begin(),
-                                      this->m_connections.end(),
-                                      same_ijk );
-            if (prev == this->m_connections.end()) {
+            const auto prev_index = this->ijk_index.find( {{I, J, k}} );
+            if (prev_index == this->ijk_index.end()) {
                 std::size_t noConn = this->m_connections.size();
                 this->addConnection(I,J,k,
                                     grid.getCellDepth( I,J,k ),
@@ -358,6 +353,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
                                     direction, ctf_kind,
                                     noConn, 0., 0., defaultSatTable);
             } else {
+                auto prev = &this->m_connections[prev_index->second];
                 std::size_t noConn = prev->getSeqIndex();
                 // The complnum value carries over; the rest of the state is fully specified by
                 // the current COMPDAT keyword.
@@ -406,26 +402,26 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
 
 
     const Connection& WellConnections::getFromIJK(const int i, const int j, const int k) const {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return get(ic);
-            }
-        }
-        throw std::runtime_error(" the connection is not found! \n ");
+        const auto iter = this->ijk_index.find( {{i, j, k}} );
+        if (iter == this->ijk_index.end())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[iter->second];
     }
 
 
     Connection& WellConnections::getFromIJK(const int i, const int j, const int k) {
-      for (size_t ic = 0; ic < size(); ++ic) {
-        if (get(ic).sameCoordinate(i, j, k)) {
-          return this->m_connections[ic];
-        }
-      }
-      throw std::runtime_error(" the connection is not found! \n ");
+        const auto iter = this->ijk_index.find( {{i, j, k}} );
+        if (iter == this->ijk_index.end())
+            throw std::runtime_error(" the connection is not found! \n ");
+
+        return this->m_connections[iter->second];
     }
 
 
     void WellConnections::add( Connection connection ) {
+        this->ijk_index.emplace( std::array<int,3>{{connection.getI(), connection.getJ(), connection.getK()}},
+                                 m_connections.size() );
         m_connections.emplace_back( connection );
     }
 
@@ -470,6 +466,7 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
             size_t next_index = findClosestConnection(prev.getI(), prev.getJ(), prevz, pos);
             std::swap(m_connections[next_index], m_connections[pos]);
         }
+        this->buildIJKIndex();
     }
 
 
@@ -520,6 +517,24 @@ inline std::array< size_t, 3> directionIndices(const Opm::Connection::Direction
                                       [&grid](const Connection& c) { return !grid.cellActive(c.getI(), c.getJ(), c.getK()); });
         this->num_removed += std::distance(new_end, m_connections.end());
         m_connections.erase(new_end, m_connections.end());
+        this->buildIJKIndex();
+    }
+
+
+    void WellConnections::buildIJKIndex() {
+        this->ijk_index.clear();
+        for (std::size_t index = 0; index < this->m_connections.size(); index++) {
+            const auto& c = this->m_connections[index];
+            this->ijk_index.emplace( std::array<int,3>{{c.getI(), c.getJ(), c.getK()}}, index );
+        }
+    }
+
+
+    std::size_t WellConnections::IJKHash::operator()(const std::array<int,3>& ijk) const {
+        std::size_t seed = 0;
+        for (const auto& value : ijk)
+            seed ^= std::hash<int>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
     }
 
 
@@ -17,9 +17,12 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cctype>
 #include <fstream>
 #include <iterator>
+#include <set>
+#include <stack>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
@@ -361,6 +364,13 @@ class ParserState {
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
+
+        /*
+          Set when a single include file is parsed on its own to update an
+          existing deck. Parsing is abandoned if the file contains something
+          which can affect the parsing of the rest of the deck.
+        */
+        bool isolated = false;
 };
 
 const boost::filesystem::path& ParserState::current_path() const {
@@ -476,6 +486,7 @@ void ParserState::loadFile(const boost::filesystem::path& inputFile) {
                                 + inputFileCanonical.string() + "'" );
 
     this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFileCanonical );
+    this->deck.addInputFile( inputFileCanonical.string() );
 }
 
 /*
@@ -833,8 +844,126 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 }
 
 
-bool parseState( ParserState& parserState, const Parser& parser ) {
+/*
+  Data keywords like PORO and ZCORN are typically by far the largest keywords
+  in the deck, and the conversion from raw string tokens to numerical values
+  dominates the parsing time. Such keywords can not influence how the rest of
+  the deck is tokenized, so when the parser is configured with more than one
+  thread their conversion is deferred: a placeholder keyword is added to the
+  deck to reserve the position, and the pending keywords are converted
+  concurrently when the input is exhausted, or before embedded Python code
+  gets to look at the deck.
+*/
+
+struct PendingKeyword {
+    PendingKeyword(std::size_t index_arg,
+                   std::unique_ptr<RawKeyword> raw_arg,
+                   const ParserKeyword& parserKeyword_arg,
+                   const UnitSystem& active_arg,
+                   const UnitSystem& default_arg,
+                   const std::string& filename_arg) :
+        index(index_arg),
+        raw(std::move(raw_arg)),
+        parserKeyword(&parserKeyword_arg),
+        active_unitsystem(active_arg),
+        default_unitsystem(default_arg),
+        filename(filename_arg)
+    {}
+
+    std::size_t index;
+    std::unique_ptr<RawKeyword> raw;
+    const ParserKeyword* parserKeyword;
+    UnitSystem active_unitsystem;
+    UnitSystem default_unitsystem;
+    std::string filename;
+    std::string error;
+};
+
+
+std::string keyword_error(const RawKeyword& rawKeyword, const std::exception& exc) {
+    const auto& location = rawKeyword.location();
+    return "\nFailed to parse keyword: " + rawKeyword.getKeywordName() + "\n" +
+           "In file " + location.filename + ", line " +  std::to_string(location.lineno) + "\n\n" +
+           "Error message: " + exc.what() + "\n";
+}
+
+
+void defer_keyword( ParserState& parserState,
+                    std::vector<PendingKeyword>& pending,
+                    std::unique_ptr<RawKeyword> rawKeyword,
+                    const ParserKeyword& parserKeyword,
+                    const std::string& filename) {
+    auto& active = parserState.deck.getActiveUnitSystem();
+    auto& deflt = parserState.deck.getDefaultUnitSystem();
+
+    /*
+      The unit systems are copied for each pending keyword; registering the
+      dimensions in the deck's unit systems up front makes sure the deck
+      sees the same use of the active unit system as with serial parsing.
+    */
+    for (const auto& item : parserKeyword.getRecord(0)) {
+        if (item.dataType() != type_tag::fdouble && item.dataType() != type_tag::uda)
+            continue;
+
+        for (const auto& dim : item.dimensions()) {
+            active.getNewDimension(dim);
+            deflt.getNewDimension(dim);
+        }
+    }
+
+    DeckKeyword placeholder( rawKeyword->location(), rawKeyword->getKeywordName() );
+    placeholder.setDataKeyword( true );
+
+    const auto index = parserState.deck.size();
+    parserState.deck.addKeyword( std::move(placeholder) );
+    pending.emplace_back( index, std::move(rawKeyword), parserKeyword, active, deflt, filename );
+}
+
+
+void convert_pending( ParserState& parserState, std::vector<PendingKeyword>& pending, int num_threads ) {
+#ifndef _OPENMP
+    (void) num_threads;
+#endif
+
+    const auto num_pending = static_cast<long>(pending.size());
+    std::vector<DeckKeyword> keywords( pending.size() );
+
+    /*
+      A data keyword consists of one item which consumes the complete
+      record, hence the ParseContext / ErrorGuard pair is never consulted
+      from the worker threads.
+    */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads) if (num_threads > 1)
+#endif
+    for (long i = 0; i < num_pending; i++) {
+        auto& kw = pending[i];
+        try {
+            keywords[i] = kw.parserKeyword->parse( parserState.parseContext,
+                                                   parserState.errors,
+                                                   *kw.raw,
+                                                   kw.active_unitsystem,
+                                                   kw.default_unitsystem,
+                                                   kw.filename );
+        } catch (const std::exception& exc) {
+            kw.error = keyword_error(*kw.raw, exc);
+        }
+    }
+
+    for (std::size_t i = 0; i < pending.size(); i++) {
+        if (!pending[i].error.empty())
+            throw std::invalid_argument(pending[i].error);
+
+        parserState.deck.getKeyword( pending[i].index ) = std::move( keywords[i] );
+    }
+
+    pending.clear();
+}
+
+
+bool parseKeywords( ParserState& parserState, const Parser& parser, std::vector<PendingKeyword>& pending ) {
     std::string filename = parserState.current_path().string();
+    const bool defer_data = parser.parseThreads() > 1;
 
     while( !parserState.done() ) {
         auto rawKeyword = tryParseKeyword( parserState, parser);
@@ -842,13 +971,21 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             continue;
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::end)
-            return true;
+            return !parserState.isolated;
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::endinclude) {
             parserState.closeFile();
             continue;
         }
 
+        if (parserState.isolated) {
+            const auto& kwname = rawKeyword->getKeywordName();
+            if (kwname == Opm::RawConsts::paths ||
+                kwname == Opm::RawConsts::include ||
+                kwname == Opm::RawConsts::pyinput)
+                return false;
+        }
+
         if (rawKeyword->getKeywordName() == Opm::RawConsts::paths) {
             for( const auto& record : *rawKeyword ) {
                 std::string pathName = readValueToken<std::string>(record.getItem(0));
@@ -880,9 +1017,16 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                    << " in file " << location.filename << ", line " << std::to_string(location.lineno);
                 OpmLog::info(ss.str());
             }
+
+            if (defer_data && parserKeyword.isDataKeyword()) {
+                defer_keyword( parserState, pending, std::move(rawKeyword), parserKeyword, filename );
+                continue;
+            }
+
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
                     if (parserState.python) {
+                        convert_pending( parserState, pending, parser.parseThreads() );
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
                         parserState.python->exec(python_string, parser, parserState.deck);
                     }
@@ -902,12 +1046,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                   error message; the parser is quite confused at this state and
                   we should not be tempted to continue the parsing.
                 */
-                const auto& location = rawKeyword->location();
-                std::string msg = "\nFailed to parse keyword: " + rawKeyword->getKeywordName() + "\n" +
-                                  "In file " + location.filename + ", line " +  std::to_string(location.lineno) + "\n\n" +
-                                  "Error message: " + exc.what() + "\n";
-
-                throw std::invalid_argument(msg);
+                throw std::invalid_argument(keyword_error(*rawKeyword, exc));
             }
         } else {
             const std::string msg = "The keyword " + rawKeyword->getKeywordName() + " is not recognized - ignored";
@@ -919,6 +1058,14 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     return true;
 }
 
+
+bool parseState( ParserState& parserState, const Parser& parser ) {
+    std::vector<PendingKeyword> pending;
+    bool result = parseKeywords( parserState, parser, pending );
+    convert_pending( parserState, pending, parser.parseThreads() );
+    return result;
+}
+
 }
 
 
@@ -935,6 +1082,14 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             addDefaultKeywords();
     }
 
+    void Parser::setParseThreads(int num_threads) {
+        this->parse_threads = std::max(1, num_threads);
+    }
+
+    int Parser::parseThreads() const {
+        return this->parse_threads;
+    }
+
 
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
@@ -1026,6 +1181,96 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return this->parseString(data, ParseContext(), errors);
     }
 
+    /*
+      The keywords from a changed file are replaced if the file was included
+      once and did not include other files; i.e. all of its keywords form one
+      consecutive block in the deck. The number of inclusions is taken from
+      the list of files opened by the parser, so a file which is included
+      several times back to back is not mistaken for a single block. The
+      file is parsed on its own, with the unit system keywords and the
+      keywords which define the size of other keywords from the preceding
+      part of the deck as context. Whenever the change can affect the
+      parsing of other files - the file is the data file, changes unit
+      system, sizing keywords, path aliases or includes - the complete deck
+      is parsed again instead.
+    */
+    Deck Parser::reparseFiles(const Deck& deck,
+                              const std::vector<std::string>& changed_files,
+                              const ParseContext& parseContext,
+                              ErrorGuard& errors) const {
+        const auto& data_file = deck.getDataFile();
+        if (data_file.empty())
+            throw std::invalid_argument("Can only reparse a deck which has been loaded from file");
+
+        const auto full_parse = [&]() {
+            return this->parseFile(data_file, parseContext, errors);
+        };
+
+        std::set<std::string> context_keywords = {"FIELD", "METRIC", "LAB", "PVT-M"};
+        for (const auto& parserKeyword : this->keyword_storage) {
+            if (parserKeyword.getSizeType() == OTHER_KEYWORD_IN_DECK)
+                context_keywords.insert( parserKeyword.getKeywordSize().keyword );
+        }
+
+        const auto is_context = [&context_keywords](const DeckKeyword& kw) {
+            return context_keywords.count(kw.name()) > 0;
+        };
+
+        const auto root_file = boost::filesystem::canonical(data_file).string();
+        auto keywords = deck.keywords();
+        for (const auto& changed_file : changed_files) {
+            if (!boost::filesystem::exists(changed_file))
+                return full_parse();
+
+            const auto file = boost::filesystem::canonical(changed_file).string();
+            if (file == root_file)
+                return full_parse();
+
+            const auto& input_files = deck.getInputFiles();
+            if (std::count(input_files.begin(), input_files.end(), file) != 1)
+                return full_parse();
+
+            const auto from_file = [&file](const DeckKeyword& kw) { return kw.location().filename == file; };
+            const auto first = std::find_if(keywords.begin(), keywords.end(), from_file);
+            const auto last = std::find_if_not(first, keywords.end(), from_file);
+            if (first == keywords.end() || std::find_if(last, keywords.end(), from_file) != keywords.end())
+                return full_parse();
+
+            if (std::any_of(first, last, is_context))
+                return full_parse();
+
+            ParserState parserState( this->codeKeywords(), parseContext, errors );
+            parserState.isolated = true;
+            std::for_each(keywords.begin(), first, [&parserState, &is_context](const DeckKeyword& kw) {
+                if (is_context(kw))
+                    parserState.deck.addKeyword(kw);
+            });
+
+            const auto context_size = parserState.deck.size();
+            parserState.loadFile( file );
+            if (!parseState( parserState, *this ))
+                return full_parse();
+
+            const auto& reparsed = parserState.deck.keywords();
+            if (std::any_of(reparsed.begin() + context_size, reparsed.end(), is_context))
+                return full_parse();
+
+            const auto pos = keywords.erase(first, last);
+            keywords.insert(pos, reparsed.begin() + context_size, reparsed.end());
+        }
+
+        Deck reparsed_deck( keywords,
+                            deck.getDefaultUnitSystem(),
+                            deck.activeUnitSystem().get(),
+                            data_file,
+                            deck.getInputPath(),
+                            deck.unitSystemAccessCount() );
+        for (const auto& input_file : deck.getInputFiles())
+            reparsed_deck.addInputFile( input_file );
+
+        return reparsed_deck;
+    }
+
     size_t Parser::size() const {
         return m_deckParserKeywords.size();
     }
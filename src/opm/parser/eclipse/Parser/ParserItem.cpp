@@ -17,10 +17,13 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cctype>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <type_traits>
 
 #include <boost/lexical_cast.hpp>
 
@@ -31,6 +34,7 @@
 #include <opm/parser/eclipse/Deck/UDAValue.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 #include "raw/StarToken.hpp"
 
@@ -442,6 +446,91 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+template< typename T >
+void push_defaults( DeckItem& deck_item, const ParserItem& parser_item, std::size_t count ) {
+    if (parser_item.hasDefault()) {
+        auto value = parser_item.getDefault< T >();
+        for (size_t i=0; i < count; i++)
+            deck_item.push_backDefault( value );
+    } else {
+        for (size_t i=0; i < count; i++)
+            deck_item.push_backDummyDefault<T>();
+    }
+}
+
+template< typename T >
+void scan_token( DeckItem& deck_item, const ParserItem& parser_item, const string_view& token ) {
+    std::string countString;
+    std::string valueString;
+
+    if( !isStarToken( token, countString, valueString ) ) {
+        deck_item.push_back( readValueToken< T >( token ) );
+        return;
+    }
+
+    StarToken st(token, countString, valueString);
+
+    if( st.hasValue() ) {
+        deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
+        return;
+    }
+
+    push_defaults< T >( deck_item, parser_item, st.count() );
+}
+
+/*
+  Scans the plain tokens 'value' and 'N*value' without going through
+  temporary strings; everything else is left to scan_token().
+*/
+template< typename T >
+void scan_fast_token( DeckItem& deck_item, const ParserItem& parser_item, const string_view& token ) {
+    T value;
+    if (readFastValueToken< T >( token, value )) {
+        deck_item.push_back( value );
+        return;
+    }
+
+    const auto star = std::find_if_not( token.begin(), token.end(), []( char c ) { return std::isdigit(static_cast<unsigned char>(c)); } );
+    if (star != token.begin() && star != token.end() && *star == '*' && (star - token.begin()) <= 9) {
+        std::size_t count = 0;
+        for (auto cursor = token.begin(); cursor != star; ++cursor)
+            count = 10*count + (*cursor - '0');
+
+        const string_view value_token( star + 1, token.end() );
+        if (count > 0) {
+            if (value_token.size() == 0) {
+                push_defaults< T >( deck_item, parser_item, count );
+                return;
+            }
+
+            if (readFastValueToken< T >( value_token, value )) {
+                deck_item.push_back( value, count );
+                return;
+            }
+        }
+    }
+
+    scan_token< T >( deck_item, parser_item, token );
+}
+
+/*
+  Bulk path for items consuming the complete, not yet tokenized, record -
+  i.e. the numerical data keywords like PORO and ZCORN. The tokens are
+  converted directly from the record string.
+*/
+template< typename T >
+void scan_record_string( DeckItem& deck_item, const ParserItem& parser_item, const string_view& record ) {
+    auto current = record.begin();
+    while( (current = std::find_if_not( current, record.end(), RawConsts::is_separator() )) != record.end() ) {
+        auto token_end = (*current == RawConsts::quote)
+                       ? std::find( current + 1, record.end(), RawConsts::quote ) + 1
+                       : std::find_if( current, record.end(), RawConsts::is_separator() );
+
+        scan_fast_token< T >( deck_item, parser_item, string_view( current, token_end ) );
+        current = token_end;
+    }
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
     bool parse_raw = parser_item.parseRaw();
@@ -455,34 +544,14 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
             return;
         }
 
-        while( record.size() > 0 ) {
-            auto token = record.pop_front();
-
-            std::string countString;
-            std::string valueString;
-
-            if( !isStarToken( token, countString, valueString ) ) {
-                deck_item.push_back( readValueToken< T >( token ) );
-                continue;
-            }
-
-            StarToken st(token, countString, valueString);
-
-            if( st.hasValue() ) {
-                deck_item.push_back( readValueToken< T >( st.valueString() ), st.count() );
-                continue;
-            }
-
-            if (parser_item.hasDefault()) {
-                auto value = parser_item.getDefault< T >();
-                for (size_t i=0; i < st.count(); i++)
-                    deck_item.push_backDefault( value );
-            } else {
-                for (size_t i=0; i < st.count(); i++)
-                    deck_item.push_backDummyDefault<T>();
-            }
+        if (std::is_arithmetic< T >::value && !record.isTokenized()) {
+            scan_record_string< T >( deck_item, parser_item, record.takeRecordString() );
+            return;
         }
 
+        while( record.size() > 0 )
+            scan_token< T >( deck_item, parser_item, record.pop_front() );
+
         return;
     }
 
@@ -81,11 +81,10 @@ inline bool even_quotes( const T& str ) {
         m_sanitizedRecordString( singleRecordString )
     {
 
-        if (text)
+        if (text) {
             this->m_recordItems.push_back(this->m_sanitizedRecordString);
-        else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
+            this->m_tokenized = true;
+        } else {
             if( !even_quotes( singleRecordString ) )
                 throw std::invalid_argument("Input string is not a complete record string, "
                                             "offending string: '" + singleRecordString + "'");
@@ -96,11 +95,35 @@ inline bool even_quotes( const T& str ) {
         RawRecord(singleRecordString, false)
     {}
 
+    void RawRecord::splitRecordString() const {
+        this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
+        this->m_tokenized = true;
+    }
+
+    bool RawRecord::empty() const {
+        if (this->m_tokenized)
+            return this->m_recordItems.empty();
+
+        return std::all_of( m_sanitizedRecordString.begin(),
+                            m_sanitizedRecordString.end(),
+                            RawConsts::is_separator() );
+    }
+
+    string_view RawRecord::takeRecordString() {
+        if (this->m_tokenized)
+            throw std::logic_error("The record string can not be taken from a tokenized record");
+
+        this->m_tokenized = true;
+        return this->m_sanitizedRecordString;
+    }
+
     void RawRecord::prepend( size_t count, string_view tok ) {
+        this->tokenize();
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
     }
 
     void RawRecord::dump() const {
+        this->tokenize();
         std::cout << "RecordDump: ";
         for (size_t i = 0; i < m_recordItems.size(); i++) {
             std::cout
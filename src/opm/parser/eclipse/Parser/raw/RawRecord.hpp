@@ -42,32 +42,59 @@ namespace Opm {
         void push_front( string_view token );
         void prepend( size_t count, string_view token );
         inline size_t size() const;
+        bool empty() const;
 
         std::string getRecordString() const;
         inline string_view getItem(size_t index) const;
 
+        /*
+          The record string is only split into tokens when the tokens are
+          first accessed. Before that the complete record string can be
+          consumed in one go with takeRecordString(), which leaves the
+          record empty; this allows bulk numerical data to be converted
+          without building the token deque.
+        */
+        inline bool isTokenized() const;
+        string_view takeRecordString();
+
         void dump() const;
 
     private:
+        inline void tokenize() const;
+        void splitRecordString() const;
+
         string_view m_sanitizedRecordString;
-        std::deque< string_view > m_recordItems;
+        mutable std::deque< string_view > m_recordItems;
+        mutable bool m_tokenized = false;
     };
 
     /*
      * These are frequently called, but fairly trivial in implementation, and
      * inlining the calls gives a decent low-effort performance benefit.
      */
+    void RawRecord::tokenize() const {
+        if (!this->m_tokenized)
+            this->splitRecordString();
+    }
+
+    bool RawRecord::isTokenized() const {
+        return this->m_tokenized;
+    }
+
     string_view RawRecord::pop_front() {
+        this->tokenize();
         auto front = m_recordItems.front();
         this->m_recordItems.pop_front();
         return front;
     }
 
     size_t RawRecord::size() const {
+        this->tokenize();
         return m_recordItems.size();
     }
 
     string_view RawRecord::getItem(size_t index) const {
+        this->tokenize();
         return this->m_recordItems.at( index );
     }
 }
@@ -22,6 +22,7 @@
 #include <cctype>
 #include <string>
 #include <stdexcept>
+#include <cstdint>
 #include <cstdlib>
 
 #include <boost/spirit/include/qi.hpp>
@@ -108,6 +109,117 @@ namespace Opm {
     }
 
 
+    template<>
+    bool readFastValueToken< int >( const string_view& view, int& value ) {
+        auto cursor = view.begin();
+        const bool negative = (cursor != view.end() && *cursor == '-');
+        if (cursor != view.end() && (*cursor == '-' || *cursor == '+'))
+            ++cursor;
+
+        // At most nine digits can not overflow
+        const auto num_digits = view.end() - cursor;
+        if (num_digits == 0 || num_digits > 9)
+            return false;
+
+        int n = 0;
+        for (; cursor != view.end(); ++cursor) {
+            if (!std::isdigit(static_cast<unsigned char>(*cursor)))
+                return false;
+            n = 10*n + (*cursor - '0');
+        }
+
+        value = negative ? -n : n;
+        return true;
+    }
+
+    template<>
+    bool readFastValueToken< double >( const string_view& view, double& value ) {
+        /*
+          The value is assembled as an integer mantissa and a decimal
+          exponent. When the mantissa has at most 15 significant digits and
+          the power of ten is exactly representable the conversion
+          mantissa * 10^exponent is correctly rounded.
+        */
+        static const double pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        const int max_digits = 15;
+
+        auto cursor = view.begin();
+        const auto end = view.end();
+        const bool negative = (cursor != end && *cursor == '-');
+        if (cursor != end && (*cursor == '-' || *cursor == '+'))
+            ++cursor;
+
+        std::uint64_t mantissa = 0;
+        int significant = 0;
+        int exponent = 0;
+        bool has_digits = false;
+
+        for (; cursor != end && std::isdigit(static_cast<unsigned char>(*cursor)); ++cursor) {
+            has_digits = true;
+            if (mantissa == 0 && *cursor == '0')
+                continue;
+
+            if (++significant > max_digits)
+                return false;
+            mantissa = 10*mantissa + (*cursor - '0');
+        }
+
+        if (cursor != end && *cursor == '.') {
+            for (++cursor; cursor != end && std::isdigit(static_cast<unsigned char>(*cursor)); ++cursor) {
+                has_digits = true;
+                exponent--;
+                if (mantissa == 0 && *cursor == '0')
+                    continue;
+
+                if (++significant > max_digits)
+                    return false;
+                mantissa = 10*mantissa + (*cursor - '0');
+            }
+        }
+
+        if (!has_digits)
+            return false;
+
+        if (cursor != end) {
+            if (*cursor != 'e' && *cursor != 'E' && *cursor != 'd' && *cursor != 'D')
+                return false;
+            ++cursor;
+
+            const bool negative_exp = (cursor != end && *cursor == '-');
+            if (cursor != end && (*cursor == '-' || *cursor == '+'))
+                ++cursor;
+
+            const auto num_digits = end - cursor;
+            if (num_digits == 0 || num_digits > 4)
+                return false;
+
+            int exp = 0;
+            for (; cursor != end; ++cursor) {
+                if (!std::isdigit(static_cast<unsigned char>(*cursor)))
+                    return false;
+                exp = 10*exp + (*cursor - '0');
+            }
+            exponent += negative_exp ? -exp : exp;
+        }
+
+        double n = 0;
+        if (mantissa != 0) {
+            if (exponent < -22 || exponent > 22)
+                return false;
+
+            n = static_cast<double>(mantissa);
+            if (exponent < 0)
+                n /= pow10[-exponent];
+            else
+                n *= pow10[exponent];
+        }
+
+        value = negative ? -n : n;
+        return true;
+    }
+
     template <>
     std::string readValueToken< std::string >( string_view view ) {
         if( view.size() == 0 || view[ 0 ] != '\'' )
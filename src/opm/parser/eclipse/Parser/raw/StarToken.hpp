@@ -33,6 +33,23 @@ namespace Opm {
     template <class T>
     T readValueToken( string_view );
 
+    /*
+      Fast conversion of plain numerical tokens like '100', '-0.25' and
+      '1.5D3'. Returns false if the token is not on such a simple form,
+      or the conversion can not be done exactly; readValueToken() must then
+      be used.
+    */
+    template <class T>
+    bool readFastValueToken( const string_view&, T& ) {
+        return false;
+    }
+
+    template <>
+    bool readFastValueToken< int >( const string_view&, int& );
+
+    template <>
+    bool readFastValueToken< double >( const string_view&, double& );
+
 class StarToken {
 public:
     StarToken(const string_view& token)
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <memory>
@@ -203,3 +204,54 @@ BOOST_AUTO_TEST_CASE(TestKeywordBox2) {
         BOOST_CHECK_EQUAL(il[i].active_index, 98 + i*100);
     }
 }
+
+BOOST_AUTO_TEST_CASE(BoxIndexRuns) {
+    Opm::EclipseGrid grid(10,10,10);
+    std::vector<int> actnum(grid.getCartesianSize(), 1);
+    actnum[0] = 0;
+    actnum[5] = 0;
+    actnum[6] = 0;
+    actnum[215] = 0;
+    grid.resetACTNUM(actnum);
+
+    Opm::Box box(grid,0,9,0,4,0,2);
+    const auto& runs = box.index_runs();
+    // 15 rows, two of them are split in two by inactive cells.
+    BOOST_CHECK_EQUAL(runs.size(), 17U);
+    BOOST_CHECK_EQUAL(runs[0].global_index, 1U);
+    BOOST_CHECK_EQUAL(runs[0].length, 4U);
+    BOOST_CHECK_EQUAL(runs[1].global_index, 7U);
+    BOOST_CHECK_EQUAL(runs[1].active_index, 4U);
+    BOOST_CHECK_EQUAL(runs[1].data_index, 7U);
+    BOOST_CHECK_EQUAL(runs[1].length, 3U);
+
+    // The expected indices of the active cells in the box, in the order
+    // the cells are stored in a keyword covering the box.
+    std::vector<Opm::Box::cell_index> expected;
+    for (std::size_t k = 0; k <= 2; k++) {
+        for (std::size_t j = 0; j <= 4; j++) {
+            for (std::size_t i = 0; i <= 9; i++) {
+                const std::size_t global_index = i + 10 * (j + 10 * k);
+                if (actnum[global_index] == 0)
+                    continue;
+
+                const std::size_t active_index = std::count(actnum.begin(), actnum.begin() + global_index, 1);
+                const std::size_t data_index = i + 10 * (j + 5 * k);
+                expected.emplace_back(global_index, active_index, data_index);
+            }
+        }
+    }
+
+    std::vector<Opm::Box::cell_index> expanded;
+    for (const auto& run : runs)
+        for (std::size_t n = 0; n < run.length; n++)
+            expanded.emplace_back(run.global_index + n, run.active_index + n, run.data_index + n);
+
+    BOOST_CHECK_EQUAL(expanded.size(), expected.size());
+    for (std::size_t i = 0; i < std::min(expanded.size(), expected.size()); i++) {
+        BOOST_CHECK_EQUAL(expanded[i].global_index, expected[i].global_index);
+        BOOST_CHECK_EQUAL(expanded[i].active_index, expected[i].active_index);
+        BOOST_CHECK_EQUAL(expanded[i].data_index, expected[i].data_index);
+    }
+    BOOST_CHECK_EQUAL(box.getIndexList().size(), box.size());
+}
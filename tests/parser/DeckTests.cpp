@@ -18,7 +18,10 @@
  */
 
 
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
+#include <fstream>
 #include <sstream>
 
 #define BOOST_TEST_MODULE DeckTests
@@ -28,6 +31,7 @@
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 #include <opm/parser/eclipse/Deck/DeckOutput.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/parser/eclipse/Parser/ParseContext.hpp>
@@ -37,6 +41,8 @@
 
 #include "src/opm/parser/eclipse/Parser/raw/RawRecord.hpp"
 
+#include <tests/WorkArea.cpp>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_CASE(hasKeyword_empty_returnFalse) {
@@ -340,6 +346,51 @@ BOOST_AUTO_TEST_CASE(HasValue) {
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(1) );
 }
 
+BOOST_AUTO_TEST_CASE(ValueStatusRuns) {
+    Dimension dim{ "Length" , 2 };
+    Dimension defaultDim{ "Length" , 100 };
+    DeckItem item( "HEI", double(), { dim }, { defaultDim } );
+
+    item.push_back( 1.0, 3 );
+    item.push_backDefault( 1.0 );
+    item.push_backDefault( 1.0 );
+    item.push_back( 1.0 );
+    item.push_backDummyDefault<double>();
+
+    const std::vector<value::status> expected = { value::status::deck_value, value::status::deck_value, value::status::deck_value,
+                                                  value::status::valid_default, value::status::valid_default,
+                                                  value::status::deck_value, value::status::empty_default };
+    BOOST_CHECK( item.getValueStatus() == expected );
+    BOOST_CHECK_EQUAL( item.data_size(), 7U );
+
+    const auto& runs = item.getValueStatusRuns();
+    BOOST_REQUIRE_EQUAL( runs.size(), 4U );
+    BOOST_CHECK( runs[1].value_status == value::status::valid_default );
+    BOOST_CHECK_EQUAL( runs[1].end, 5U );
+    BOOST_CHECK( runs[3].value_status == value::status::empty_default );
+    BOOST_CHECK_EQUAL( runs[3].end, 7U );
+    BOOST_CHECK( !item.defaultApplied(2) );
+    BOOST_CHECK( item.defaultApplied(3) );
+    BOOST_CHECK( !item.defaultApplied(5) );
+    BOOST_CHECK( !item.hasValue(6) );
+    BOOST_CHECK_THROW( item.defaultApplied(7), std::out_of_range );
+
+    const auto& si_data = item.getSIDoubleData();
+    BOOST_CHECK_EQUAL( si_data[2], 2 );
+    BOOST_CHECK_EQUAL( si_data[4], 100 );
+    BOOST_CHECK_EQUAL( si_data[5], 2 );
+    BOOST_CHECK_EQUAL( item.getData<double>()[4], 1.0 );
+
+    DeckItem copy( item.dVal(), item.iVal(), item.sVal(), item.uVal(), item.getType(), item.name(),
+                   item.valueStatus(), item.rawData(), item.activeDimensions(), item.defaultDimensions() );
+    BOOST_CHECK( copy.equal( item, true, true ) );
+
+    DeckItem explicit_values( "HEI", double(), { dim }, { defaultDim } );
+    explicit_values.push_back( 1.0, 6 );
+    explicit_values.push_backDummyDefault<double>();
+    BOOST_CHECK( !explicit_values.equal( item, true, true ) );
+}
+
 BOOST_AUTO_TEST_CASE(DummyDefaultsInt) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL(deckIntItem.data_size(), 0);
@@ -689,3 +740,79 @@ BOOST_AUTO_TEST_CASE(STRING_TO_BOOL) {
     BOOST_CHECK_THROW(DeckItem::to_bool("YE"), std::invalid_argument);
     BOOST_CHECK_THROW(DeckItem::to_bool("YE"), std::invalid_argument);
 }
+
+
+BOOST_AUTO_TEST_CASE(DECK_CACHE) {
+    WorkArea work_area;
+    {
+        std::ofstream data_file("CASE.DATA");
+        data_file << R"(
+RUNSPEC
+FIELD
+DIMENS
+ 2 2 1 /
+GRID
+INCLUDE
+ 'grid.inc' /
+INCLUDE
+ 'comments.inc' /
+SCHEDULE
+WCONPROD
+ 'W1' 'OPEN' 'ORAT' 100 /
+/
+)";
+        std::ofstream include_file("grid.inc");
+        include_file << "PORO\n 4*0.25 /\nPERMX\n 100 200 2* /\n";
+        std::ofstream comment_file("comments.inc");
+        comment_file << "-- No keywords here\n";
+    }
+
+    Parser parser;
+    auto deck = parser.parseFile("CASE.DATA");
+    DeckCache::save(deck, "CASE.CACHE");
+
+    Deck cached_deck;
+    BOOST_CHECK( DeckCache::load("CASE.CACHE", cached_deck) );
+    BOOST_CHECK( cached_deck == deck );
+    BOOST_CHECK_EQUAL( cached_deck.size(), deck.size() );
+    BOOST_CHECK_EQUAL( cached_deck.getKeyword("PERMX").getSIDoubleData()[1], deck.getKeyword("PERMX").getSIDoubleData()[1] );
+    BOOST_CHECK( cached_deck.getKeyword("PORO").isDataKeyword() );
+    BOOST_CHECK_EQUAL( cached_deck.getKeyword("WCONPROD").location().lineno, deck.getKeyword("WCONPROD").location().lineno );
+    BOOST_CHECK( cached_deck.getActiveUnitSystem() == deck.getActiveUnitSystem() );
+    BOOST_CHECK( cached_deck.getInputFiles() == deck.getInputFiles() );
+    BOOST_CHECK_EQUAL( deck.getInputFiles().size(), 3U );
+
+    // Include files without keywords are also part of the content check
+    {
+        std::ofstream comment_file("comments.inc");
+        comment_file << "-- Still no keywords here\n";
+    }
+    BOOST_CHECK( !DeckCache::load("CASE.CACHE", cached_deck) );
+    DeckCache::save(deck, "CASE.CACHE");
+    BOOST_CHECK( DeckCache::load("CASE.CACHE", cached_deck) );
+
+    // Corrupt element counts are rejected without allocating
+    {
+        std::ofstream corrupt_file("CORRUPT.CACHE", std::ios::binary);
+        const char magic[8] = {'O', 'P', 'M', 'D', 'E', 'C', 'K', '\0'};
+        const std::uint64_t no_files = 0;
+        const std::uint64_t huge_count = std::numeric_limits<std::uint64_t>::max();
+        corrupt_file.write(magic, sizeof magic);
+        corrupt_file.write(reinterpret_cast<const char*>(&DeckCache::format_version), sizeof DeckCache::format_version);
+        corrupt_file.write(reinterpret_cast<const char*>(&no_files), sizeof no_files);
+        corrupt_file.write(reinterpret_cast<const char*>(&no_files), sizeof no_files);
+        corrupt_file.write(reinterpret_cast<const char*>(&no_files), sizeof no_files);
+        corrupt_file.write(reinterpret_cast<const char*>(&huge_count), sizeof huge_count);
+    }
+    Deck corrupt_deck;
+    BOOST_CHECK( !DeckCache::load("CORRUPT.CACHE", corrupt_deck) );
+
+    // Changing an include file invalidates the cache
+    {
+        std::ofstream include_file("grid.inc");
+        include_file << "PORO\n 4*0.30 /\n";
+    }
+    Deck stale_deck;
+    BOOST_CHECK( !DeckCache::load("CASE.CACHE", stale_deck) );
+    BOOST_CHECK( !DeckCache::load("NO_SUCH_FILE.CACHE", stale_deck) );
+}
@@ -334,3 +334,119 @@ BOOST_AUTO_TEST_CASE( UNIQUE ) {
     BOOST_CHECK(unique1[2] == std::make_pair(std::size_t{6}, 600));
 }
 
+
+
+namespace {
+    Opm::TimeMap make_timemap(std::size_t num_steps) {
+        Opm::TimeMap timeMap{ Opm::TimeMap::mkdate(2010, 1, 1) };
+        for (size_t i = 0; i < num_steps; i++)
+            timeMap.addTStep((i+1) * 24 * 60 * 60);
+        return timeMap;
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( update_elm_inside_run ) {
+    Opm::DynamicState<int> state(make_timemap(10) , 0);
+    state.update(3, 30);
+    state.update(7, 70);
+
+    state.update_elm(5, 55);
+    state.update_elm(0, 1);
+    const std::vector<int> expected = {1, 0, 0, 30, 30, 55, 30, 70, 70, 70, 70};
+    BOOST_CHECK( state.data() == expected );
+    BOOST_CHECK_EQUAL( state.back(), 70 );
+}
+
+
+BOOST_AUTO_TEST_CASE( update_equal_inside_run ) {
+    Opm::DynamicState<int> state(make_timemap(10) , 0);
+    state.update(2, 20);
+    state.update(6, 60);
+    state.update_elm(4, 0);
+
+    state.update_equal(2, 5);
+    {
+        const std::vector<int> expected = {0, 0, 5, 5, 0, 20, 60, 60, 60, 60, 60};
+        BOOST_CHECK( state.data() == expected );
+    }
+
+    state.update_equal(7, 70);
+    {
+        const std::vector<int> expected = {0, 0, 5, 5, 0, 20, 60, 70, 70, 70, 70};
+        BOOST_CHECK( state.data() == expected );
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE( updateInitial_after_update ) {
+    Opm::DynamicState<int> state(make_timemap(10) , 1);
+    state.update(4, 40);
+    BOOST_CHECK_EQUAL( state.initialRange(), 4U );
+
+    state.updateInitial(2);
+    state.update(8, 80);
+    state.updateInitial(3);
+    const std::vector<int> expected = {3, 3, 3, 3, 40, 40, 40, 40, 80, 80, 80};
+    BOOST_CHECK( state.data() == expected );
+    BOOST_CHECK_EQUAL( state.initialRange(), 4U );
+}
+
+
+BOOST_AUTO_TEST_CASE( equal_with_different_runs ) {
+    const auto timeMap = make_timemap(10);
+    Opm::DynamicState<int> state1(timeMap , 0);
+    Opm::DynamicState<int> state2(timeMap , 0);
+    state1.update(3, 1);
+    state2.update(3, 1);
+
+    // Assigning the existing value splits the run in state1
+    state1.update_elm(5, 1);
+    state1.update_equal(9, 1);
+    BOOST_CHECK( state1 == state2 );
+    BOOST_CHECK( state2 == state1 );
+
+    Opm::DynamicState<int> state3(state1.data(), state1.initialRange());
+    BOOST_CHECK( state3 == state1 );
+
+    state1.update_elm(5, 2);
+    BOOST_CHECK( !(state1 == state2) );
+    BOOST_CHECK( !(state2 == state1) );
+}
+
+
+BOOST_AUTO_TEST_CASE( find_report_step ) {
+    Opm::DynamicState<int> state(make_timemap(10) , 0);
+    state.update(4, 10);
+    state.update(7, 20);
+
+    BOOST_CHECK_EQUAL( state.find(0), 0 );
+    BOOST_CHECK_EQUAL( state.find(10), 4 );
+    BOOST_CHECK_EQUAL( state.find(20), 7 );
+    BOOST_CHECK_EQUAL( state.find(99), -1 );
+    BOOST_CHECK_EQUAL( state.find_not(0), 4 );
+    BOOST_CHECK_EQUAL( state.find_if([](int value) { return value > 15; }), 7 );
+
+    state.update_elm(2, 20);
+    BOOST_CHECK_EQUAL( state.find(20), 2 );
+    BOOST_CHECK_EQUAL( state.find_not(0), 2 );
+}
+
+
+BOOST_AUTO_TEST_CASE( iterate_values ) {
+    Opm::DynamicState<int> state(make_timemap(10) , 0);
+    state.update(4, 10);
+    state.update(7, 20);
+
+    // The iterators visit one value for each run of equal report steps
+    const std::vector<int> values(state.begin(), state.end());
+    const std::vector<int> expected = {0, 10, 20};
+    BOOST_CHECK( values == expected );
+    BOOST_CHECK_EQUAL( state.data().size(), state.size() );
+
+    for (auto& value : state)
+        value += 1;
+    BOOST_CHECK_EQUAL( state[3], 1 );
+    BOOST_CHECK_EQUAL( state[6], 11 );
+    BOOST_CHECK_EQUAL( state[10], 21 );
+}
@@ -966,10 +966,13 @@ static Opm::Deck createActnumBoxDeck() {
 BOOST_AUTO_TEST_CASE(GridBoxActnum) {
     auto deck = createActnumBoxDeck();
     Opm::EclipseState es( deck);
-    auto ep = es.get3DProperties();
     const auto& grid = es.getInputGrid();
 
-    BOOST_CHECK_NO_THROW(ep.getIntGridProperty("ACTNUM"));
+#ifdef ENABLE_3DPROPS_TESTING
+    BOOST_CHECK_NO_THROW(es.fieldProps().actnum());
+#else
+    BOOST_CHECK_NO_THROW(es.get3DProperties().getIntGridProperty("ACTNUM"));
+#endif
 
     size_t active = 10 * 10 * 10     // 1000
                     - (10 * 10 * 1)  // - top layer
@@ -1017,14 +1020,17 @@ BOOST_AUTO_TEST_CASE(GridActnumVia3D) {
     auto deck = createActnumDeck();
 
     Opm::EclipseState es( deck);
-    auto ep = es.get3DProperties();
     const auto& grid = es.getInputGrid();
     Opm::EclipseGrid grid2( grid );
 
     std::vector<int> actnum = {1, 1, 0, 1, 1, 0, 1, 1};
     Opm::EclipseGrid grid3( grid , actnum);
 
-    BOOST_CHECK_NO_THROW(ep.getIntGridProperty("ACTNUM"));
+#ifdef ENABLE_3DPROPS_TESTING
+    BOOST_CHECK_NO_THROW(es.fieldProps().actnum());
+#else
+    BOOST_CHECK_NO_THROW(es.get3DProperties().getIntGridProperty("ACTNUM"));
+#endif
     BOOST_CHECK_NO_THROW(grid.getNumActive());
     BOOST_CHECK_EQUAL(grid.getNumActive(), 2 * 2 * 2 - 1);
 
@@ -1097,6 +1103,44 @@ BOOST_AUTO_TEST_CASE(ProcessedCopy) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(CachedCellGeometry) {
+    Opm::EclipseGrid grid(3, 4, 5, 2.0, 3.0, 4.0);
+
+    // Populate the cache, and then make some cells inactive.
+    BOOST_CHECK_CLOSE( grid.getCellVolume(0), 24.0, 1e-12 );
+
+    std::vector<int> actnum(grid.getCartesianSize(), 1);
+    actnum[5] = 0;
+    actnum[17] = 0;
+    grid.resetACTNUM(actnum);
+    BOOST_CHECK_EQUAL( grid.getNumActive(), grid.getCartesianSize() - 2 );
+
+    for (std::size_t g = 0; g < grid.getCartesianSize(); g++) {
+        const auto ijk = grid.getIJK(g);
+        const auto center = grid.getCellCenter(g);
+        const auto dims = grid.getCellDims(g);
+
+        BOOST_CHECK_CLOSE( grid.getCellVolume(g), 24.0, 1e-12 );
+        BOOST_CHECK_CLOSE( grid.getCellDepth(g), 4.0 * (ijk[2] + 0.5), 1e-12 );
+        BOOST_CHECK_CLOSE( grid.getCellThickness(g), 4.0, 1e-12 );
+        BOOST_CHECK_CLOSE( center[0], 2.0 * (ijk[0] + 0.5), 1e-12 );
+        BOOST_CHECK_CLOSE( center[1], 3.0 * (ijk[1] + 0.5), 1e-12 );
+        BOOST_CHECK_CLOSE( dims[0], 2.0, 1e-12 );
+        BOOST_CHECK_CLOSE( dims[1], 3.0, 1e-12 );
+        BOOST_CHECK_CLOSE( dims[2], 4.0, 1e-12 );
+    }
+
+    // A copy with a different ZCORN must not see the cached geometry.
+    auto zcorn = grid.getZCORN();
+    for (auto& z : zcorn)
+        z *= 2;
+
+    Opm::EclipseGrid grid2(grid, zcorn.data(), actnum);
+    BOOST_CHECK_CLOSE( grid2.getCellVolume(0), 48.0, 1e-12 );
+    BOOST_CHECK_CLOSE( grid2.getCellDepth(0), 4.0, 1e-12 );
+    BOOST_CHECK_CLOSE( grid.getCellVolume(0), 24.0, 1e-12 );
+}
+
 BOOST_AUTO_TEST_CASE(regularCartGrid) {
 
     int nx = 3;
@@ -100,6 +100,18 @@ static Deck createDeckTOP() {
 BOOST_AUTO_TEST_CASE(GetPOROTOPBased) {
     auto deck = createDeckTOP();
     EclipseState state(deck );
+#ifdef ENABLE_FIELDPROPS_ONLY
+    const auto& fp = state.fieldProps();
+    const auto poro_data  = fp.get_global<double>( "PORO" );
+    const auto permx_data = fp.get_global<double>( "PERMX" );
+
+    BOOST_CHECK_EQUAL(1000U , poro_data.size() );
+    BOOST_CHECK_EQUAL(1000U , permx_data.size() );
+    for (size_t i=0; i < poro_data.size(); i++) {
+        BOOST_CHECK_EQUAL( 0.10 , poro_data[i]);
+        BOOST_CHECK_EQUAL( 0.25 * Metric::Permeability , permx_data[i]);
+    }
+#else
     const Eclipse3DProperties& props = state.get3DProperties();
 
     const GridProperty<double>& poro  = props.getDoubleGridProperty( "PORO" );
@@ -113,7 +125,28 @@ BOOST_AUTO_TEST_CASE(GetPOROTOPBased) {
         BOOST_CHECK_EQUAL( 0.10 , poro_data[i]);
         BOOST_CHECK_EQUAL( 0.25 * Metric::Permeability , permx_data[i]);
     }
+#endif
+}
+
+#ifdef ENABLE_FIELDPROPS_ONLY
+BOOST_AUTO_TEST_CASE(FieldPropsOnly) {
+    auto deck = createDeckTOP();
+    EclipseState state(deck );
+    const auto& fp = state.fieldProps();
+
+    BOOST_CHECK( fp.has<double>( "PORO" ));
+    BOOST_CHECK_EQUAL( fp.get<double>( "PORO" )[0], 0.10 );
+    BOOST_CHECK_EQUAL( fp.get<int>( "SATNUM" )[0], 2 );
+
+    const auto& props = state.get3DProperties();
+    BOOST_CHECK( props.supportsGridProperty( "PORO" ));
+    BOOST_CHECK( props.hasDeckDoubleGridProperty( "PORO" ));
+    BOOST_CHECK( props.hasDeckIntGridProperty( "SATNUM" ));
+    BOOST_CHECK_EQUAL( props.getDefaultRegionKeyword(), fp.default_region() );
+    BOOST_CHECK( props.getRegions( "SATNUM" ) == std::vector<int>{ 2 } );
+    BOOST_CHECK_THROW( props.getIntGridProperty( "SATNUM" ), std::logic_error);
 }
+#endif
 
 static Deck createDeck() {
 const char *deckData =
@@ -278,9 +311,14 @@ BOOST_AUTO_TEST_CASE(IntProperties) {
     auto deck = createDeck();
     EclipseState state( deck );
 
+#ifdef ENABLE_FIELDPROPS_ONLY
+    BOOST_CHECK_EQUAL( false, state.fieldProps().has<int>( "NONO" ) );
+    BOOST_CHECK_EQUAL( true,  state.fieldProps().has<int>( "SATNUM" ) );
+#else
     BOOST_CHECK_EQUAL( false, state.get3DProperties().supportsGridProperty( "NONO" ) );
     BOOST_CHECK_EQUAL( true,  state.get3DProperties().supportsGridProperty( "SATNUM" ) );
     BOOST_CHECK_EQUAL( true,  state.get3DProperties().hasDeckIntGridProperty( "SATNUM" ) );
+#endif
 }
 
 
@@ -288,11 +326,18 @@ BOOST_AUTO_TEST_CASE(GetProperty) {
     auto deck = createDeck();
     EclipseState state(deck);
 
+#ifdef ENABLE_FIELDPROPS_ONLY
+    const auto satnum_data = state.fieldProps().get_global<int>( "SATNUM" );
+    BOOST_CHECK_EQUAL(1000U , satnum_data.size() );
+    for (size_t i=0; i < satnum_data.size(); i++)
+        BOOST_CHECK_EQUAL( 2 , satnum_data[i]);
+#else
     const auto& satNUM = state.get3DProperties().getIntGridProperty( "SATNUM" );
     const auto& satnum_data = satNUM.getData();
     BOOST_CHECK_EQUAL(1000U , satNUM.getCartesianSize() );
     for (size_t i=0; i < satNUM.getCartesianSize(); i++)
         BOOST_CHECK_EQUAL( 2 , satnum_data[i]);
+#endif
 }
 
 BOOST_AUTO_TEST_CASE(GetTransMult) {
@@ -427,6 +472,9 @@ static Deck createDeckWithGridOpts() {
 BOOST_AUTO_TEST_CASE(NoGridOptsDefaultRegion) {
     auto deck = createDeckNoGridOpts();
     EclipseState state(deck);
+#ifdef ENABLE_FIELDPROPS_ONLY
+    BOOST_CHECK_EQUAL( state.fieldProps().default_region(), "FLUXNUM" );
+#else
     const auto& props   = state.get3DProperties();
     const auto& multnum = props.getIntGridProperty("MULTNUM");
     const auto& fluxnum = props.getIntGridProperty("FLUXNUM");
@@ -435,12 +483,16 @@ BOOST_AUTO_TEST_CASE(NoGridOptsDefaultRegion) {
 
     BOOST_CHECK_EQUAL( &fluxnum  , &def_pro );
     BOOST_CHECK_NE( &fluxnum  , &multnum );
+#endif
 }
 
 
 BOOST_AUTO_TEST_CASE(WithGridOptsDefaultRegion) {
     auto deck = createDeckWithGridOpts();
     EclipseState state(deck);
+#ifdef ENABLE_FIELDPROPS_ONLY
+    BOOST_CHECK_EQUAL( state.fieldProps().default_region(), "MULTNUM" );
+#else
     const auto& props   = state.get3DProperties();
     const auto& multnum = props.getIntGridProperty("MULTNUM");
     const auto& fluxnum = props.getIntGridProperty("FLUXNUM");
@@ -449,6 +501,7 @@ BOOST_AUTO_TEST_CASE(WithGridOptsDefaultRegion) {
 
     BOOST_CHECK_EQUAL( &multnum , &def_pro );
     BOOST_CHECK_NE( &fluxnum  , &multnum );
+#endif
 }
 
 BOOST_AUTO_TEST_CASE(TestIOConfigBaseName) {
@@ -31,6 +31,7 @@
 #include <opm/parser/eclipse/Parser/Parser.hpp>
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
+#include <opm/parser/eclipse/Units/Units.hpp>
 #include <opm/parser/eclipse/Deck/DeckSection.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
@@ -201,6 +202,44 @@ ADDREG
 
 
 
+BOOST_AUTO_TEST_CASE(ADDREG_REGION_UPDATE) {
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.1 /
+
+MULTNUM
+ 2 2 2 1 1 1 /
+
+ADDREG
+  PORO 1.0 1 M /
+/
+
+EQUALS
+  MULTNUM 3 1 3 2 2 1 1 /
+/
+
+ADDREG
+  PORO 2.0 1 M /
+  PORO 3.0 2 M /
+  PORO 0.5 3 M /
+/
+
+)";
+    std::vector<int> actnum1 = {1,1,0,0,1,1};
+    EclipseGrid grid(3,2,1); grid.resetACTNUM(actnum1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, grid, TableManager());
+    const auto& poro = fpm.get<double>("PORO");
+    BOOST_CHECK_EQUAL(poro.size(), 4);
+    BOOST_CHECK_CLOSE(poro[0], 3.10, 1e-8);
+    BOOST_CHECK_CLOSE(poro[1], 3.10, 1e-8);
+    BOOST_CHECK_CLOSE(poro[2], 1.60, 1e-8);
+    BOOST_CHECK_CLOSE(poro[3], 1.60, 1e-8);
+}
+
+
 BOOST_AUTO_TEST_CASE(ASSIGN) {
     FieldProps::FieldData<int> data(100);
     std::vector<int> wrong_size(50);
@@ -585,3 +624,154 @@ MULTZ
     BOOST_CHECK_EQUAL( multz[0], 4 );
     BOOST_CHECK_EQUAL( multx[0], 2 );
 }
+
+BOOST_AUTO_TEST_CASE(CONCURRENT_DATA_KEYWORDS) {
+    std::string deck_string = R"(
+GRID
+
+PORO
+   6*0.25 /
+
+PERMX
+   1 2 3 4 5 6 /
+
+MULTNUM
+   1 1 1 2 2 2 /
+
+NTG
+   6*0.5 /
+
+BOX
+  1 1 1 2 1 1 /
+
+PERMX
+  2*100 /
+
+PORO
+  2*0.10 /
+
+ENDBOX
+
+PERMY
+  6*7 /
+
+PERMX
+  1* 20 4* /
+
+EDIT
+
+MULTX
+  6*2 /
+
+MULTY
+  6*3 /
+
+)";
+    BOOST_CHECK_EQUAL(FieldPropsManager::threads(), 1);
+    FieldPropsManager::set_threads(4);
+
+    EclipseGrid grid(3,2,1);
+    Deck deck = Parser{}.parseString(deck_string);
+    FieldPropsManager fpm(deck, grid, TableManager());
+    const auto& permx = fpm.get<double>("PERMX");
+    const auto& permy = fpm.get<double>("PERMY");
+    const auto& poro = fpm.get<double>("PORO");
+    const auto& ntg = fpm.get<double>("NTG");
+    const auto& multnum = fpm.get<int>("MULTNUM");
+    const auto& multx = fpm.get<double>("MULTX");
+    const auto& multy = fpm.get<double>("MULTY");
+
+    const std::vector<double> expected_permx = {100, 20, 3, 100, 5, 6};
+    const std::vector<double> expected_poro = {0.10, 0.25, 0.25, 0.10, 0.25, 0.25};
+    for (std::size_t i = 0; i < 6; i++) {
+        BOOST_CHECK_CLOSE(permx[i], expected_permx[i] * Metric::Permeability, 1e-8);
+        BOOST_CHECK_CLOSE(permy[i], 7 * Metric::Permeability, 1e-8);
+        BOOST_CHECK_CLOSE(poro[i], expected_poro[i], 1e-8);
+        BOOST_CHECK_CLOSE(ntg[i], 0.5, 1e-8);
+        BOOST_CHECK_EQUAL(multnum[i], i < 3 ? 1 : 2);
+        BOOST_CHECK_CLOSE(multx[i], 2, 1e-8);
+        BOOST_CHECK_CLOSE(multy[i], 3, 1e-8);
+    }
+
+    std::string invalid_deck_string = R"(
+GRID
+
+PORO
+   6*0.25 /
+
+PERMX
+   5*1 /
+
+NTG
+   6*0.5 /
+
+)";
+    Deck invalid_deck = Parser{}.parseString(invalid_deck_string);
+    BOOST_CHECK_THROW(FieldPropsManager(invalid_deck, grid, TableManager()), std::invalid_argument);
+    FieldPropsManager::set_threads(1);
+}
+
+
+BOOST_AUTO_TEST_CASE(CONCURRENT_KERNELS_LARGE_GRID) {
+    // 6000 cells in 600 runs along I, and MULTNUM alternating between
+    // neighbouring cells, so that both the box and the region kernels
+    // exceed the threshold for parallel processing.
+    FieldPropsManager::set_threads(4);
+    const std::size_t nx = 10, ny = 30, nz = 20;
+    const std::size_t size = nx * ny * nz;
+    std::string multnum;
+    for (std::size_t g = 0; g < size; g++)
+        multnum += (g % 2 == 0) ? "1 " : "2 ";
+
+    const std::string grid_string = R"(
+GRID
+
+PORO
+   6000*0.25 /
+
+PERMX
+   6000*100 /
+
+MULTNUM
+)" + multnum + R"( /
+
+EQUALREG
+   PERMY 50 1 M /
+/
+
+ADDREG
+   PERMX 100 2 M /
+/
+)";
+
+    EclipseGrid grid(nx, ny, nz);
+    Deck deck = Parser{}.parseString(grid_string + R"(
+EQUALREG
+   PERMY 60 2 M /
+/
+
+OPERATE
+   PERMZ 1 10 1 30 1 20 'MULTX' PERMX 0.1 /
+/
+)");
+    FieldPropsManager fpm(deck, grid, TableManager());
+    const auto& permx = fpm.get<double>("PERMX");
+    const auto& permy = fpm.get<double>("PERMY");
+    const auto& permz = fpm.get<double>("PERMZ");
+
+    for (std::size_t g = 0; g < size; g++) {
+        const double expected_permx = (g % 2 == 0) ? 100 : 200;
+        BOOST_CHECK_CLOSE(permx[g], expected_permx * Metric::Permeability, 1e-8);
+        BOOST_CHECK_CLOSE(permy[g], ((g % 2 == 0) ? 50 : 60) * Metric::Permeability, 1e-8);
+        BOOST_CHECK_CLOSE(permz[g], 0.1 * expected_permx * Metric::Permeability, 1e-8);
+    }
+
+    // PERMY is only set in region 1
+    Deck unset_deck = Parser{}.parseString(grid_string + R"(
+OPERATE
+   PERMZ 1 10 1 30 1 20 'MULTX' PERMY 0.1 /
+/
+)");
+    BOOST_CHECK_THROW(FieldPropsManager(unset_deck, grid, TableManager()), std::invalid_argument);
+    FieldPropsManager::set_threads(1);
+}
@@ -275,3 +275,23 @@ BOOST_AUTO_TEST_CASE(OutputPaths) {
     BOOST_CHECK_EQUAL( "TESTSTRING", config3.getBaseName() );
     BOOST_CHECK_EQUAL( testpath, config3.fullBasePath() );
 }
+
+BOOST_AUTO_TEST_CASE(MemberConstructor) {
+    IOConfig config( "/path/to/CASE.DATA" );
+    config.setColumnarSummary( true );
+
+    IOConfig copy( config.getWriteINITFile(), config.getWriteEGRIDFile(),
+                   config.getUNIFIN(), config.getUNIFOUT(),
+                   config.getFMTIN(), config.getFMTOUT(),
+                   config.getFirstRestartStep(),
+                   config.getDeckFileName(),
+                   config.getOutputEnabled(),
+                   config.getOutputDir(),
+                   config.getNoSim(),
+                   config.getBaseName(),
+                   config.getEclCompatibleRST(),
+                   config.getColumnarSummary() );
+
+    BOOST_CHECK( copy.getColumnarSummary() );
+    BOOST_CHECK( copy == config );
+}
@@ -38,6 +38,7 @@
 #include <opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/Box.hpp>
 #include <opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp>
+#include <opm/parser/eclipse/EclipseState/Grid/TransMult.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableManager.hpp>
 
 
@@ -296,6 +297,45 @@ static Opm::Deck createCopyMULTNUMDeck() {
     return parser.parseString(deckData) ;
 }
 
+BOOST_AUTO_TEST_CASE(FaceMultipliers) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::Eclipse3DProperties props(deck, tm, grid);
+  Opm::FieldPropsManager fp(deck, grid, tm);
+
+  std::vector<const Opm::DeckKeyword*> keywords;
+  keywords.push_back( &deck.getKeyword( "MULTREGT", 0 ) );
+  Opm::MULTREGTScanner scanner(grid, fp, props, keywords);
+
+  const auto face_mult = scanner.getFaceMultipliers();
+  const std::array<Opm::FaceDir::DirEnum, 3> dirs = {Opm::FaceDir::XPlus, Opm::FaceDir::YPlus, Opm::FaceDir::ZPlus};
+  for (std::size_t k = 0; k < grid.getNZ(); k++) {
+      for (std::size_t j = 0; j < grid.getNY(); j++) {
+          for (std::size_t i = 0; i < grid.getNX(); i++) {
+              const std::array<std::size_t, 3> ijk = {i, j, k};
+              std::size_t g = grid.getGlobalIndex(i, j, k);
+              for (std::size_t d = 0; d < 3; d++) {
+                  if (ijk[d] + 1 == static_cast<std::size_t>(grid.getNXYZ()[d]))
+                      BOOST_CHECK_EQUAL( face_mult[d][g], 1.0 );
+                  else {
+                      auto n = ijk;
+                      n[d] += 1;
+                      BOOST_CHECK_EQUAL( face_mult[d][g], scanner.getRegionMultiplier(g, grid.getGlobalIndex(n[0], n[1], n[2]), dirs[d]) );
+                  }
+              }
+          }
+      }
+  }
+
+  BOOST_CHECK_EQUAL( face_mult[0][grid.getGlobalIndex(0,0,1)], 1.25 );
+  BOOST_CHECK_EQUAL( face_mult[2][grid.getGlobalIndex(2,0,0)], 0.0 );
+
+  Opm::MULTREGTScanner all_scanner(grid, fp, props, deck.getKeywordList("MULTREGT"));
+  Opm::TransMult transMult(grid, deck, fp, props);
+  BOOST_CHECK( transMult.getRegionFaceMultipliers() == all_scanner.getFaceMultipliers() );
+}
+
 BOOST_AUTO_TEST_CASE(MULTREGT_COPY_MULTNUM) {
     Opm::Deck deck = createCopyMULTNUMDeck();
     Opm::TableManager tm(deck);
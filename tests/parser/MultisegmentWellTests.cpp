@@ -311,6 +311,64 @@ BOOST_AUTO_TEST_CASE(NegativeDepthCOMPSEGS) {
     BOOST_CHECK_NO_THROW(wconns.reset(Opm::newConnectionsWithSegments(compsegs, connection_set, segment_set, grid, parseContext, errorGuard)));
 }
 
+BOOST_AUTO_TEST_CASE(LongMultilateralWell) {
+    // Two laterals branching off the top segment, with one segment and one
+    // connection per cell along the I direction.
+    const int num_segments = 500;
+    const auto dir = Opm::Connection::Direction::X;
+    const auto kind = Opm::Connection::CTFKind::DeckValue;
+    Opm::EclipseGrid grid(num_segments, 2, 1);
+    Opm::WellConnections connection_set(0,0);
+    for (int lateral = 0; lateral < 2; lateral++) {
+        for (int i = 0; i < num_segments; i++)
+            connection_set.add(Opm::Connection( i, lateral, 0, 1, 0.0, Opm::Connection::State::OPEN , 200, 17.29, 0.25, 0.0, 0.0, 0, dir, kind, 0, 0., 0., true) );
+    }
+
+    std::string welsegs_string =
+        "WELSEGS \n"
+        "'PROD01' 2000.0 0.0 1.0e-5 'ABS' 'HF-' 'HO' /\n";
+    std::string compsegs_string =
+        "COMPSEGS\n"
+        "PROD01 / \n";
+    for (int lateral = 0; lateral < 2; lateral++) {
+        for (int i = 0; i < num_segments; i++) {
+            const int segment = 2 + lateral * num_segments + i;
+            const int outlet = (i == 0) ? 1 : segment - 1;
+            const int branch = lateral + 1;
+            const double length = 10.0 * (i + 1);
+            welsegs_string += std::to_string(segment) + " " + std::to_string(segment) + " " + std::to_string(branch) + " "
+                + std::to_string(outlet) + " " + std::to_string(length) + " 2000.0 0.2 0.0001 /\n";
+            compsegs_string += std::to_string(i + 1) + " " + std::to_string(lateral + 1) + " 1 " + std::to_string(branch) + " "
+                + std::to_string(length - 10.0) + " " + std::to_string(length) + " 4* " + std::to_string(segment) + " /\n";
+        }
+    }
+
+    Opm::Parser parser;
+    Opm::Deck deck = parser.parseString(welsegs_string + "/\n" + compsegs_string + "/\n");
+
+    Opm::WellSegments segment_set;
+    segment_set.loadWELSEGS(deck.getKeyword("WELSEGS"));
+    segment_set.process(true);
+
+    const int total_segments = 2 * num_segments + 1;
+    BOOST_CHECK_EQUAL(total_segments, segment_set.size());
+    for (int segment = 1; segment <= total_segments; segment++)
+        BOOST_CHECK_EQUAL(segment, segment_set[segment_set.segmentNumberToIndex(segment)].segmentNumber());
+    BOOST_CHECK_EQUAL(-1, segment_set.segmentNumberToIndex(total_segments + 1));
+
+    Opm::ErrorGuard   errorGuard;
+    Opm::ParseContext parseContext;
+    std::unique_ptr<Opm::WellConnections> new_connection_set{nullptr};
+    BOOST_CHECK_NO_THROW(new_connection_set.reset(Opm::newConnectionsWithSegments(deck.getKeyword("COMPSEGS"), connection_set, segment_set, grid, parseContext, errorGuard)));
+
+    BOOST_CHECK_EQUAL(2U * num_segments, new_connection_set->size());
+    for (int lateral = 0; lateral < 2; lateral++) {
+        for (int i = 0; i < num_segments; i++)
+            BOOST_CHECK_EQUAL(2 + lateral * num_segments + i, new_connection_set->getFromIJK(i, lateral, 0).segment());
+    }
+    BOOST_CHECK_THROW(new_connection_set->getFromIJK(0, 0, 1), std::runtime_error);
+}
+
 BOOST_AUTO_TEST_CASE(testwsegvalv) {
     auto dir = Opm::Connection::Direction::Z;
     const auto kind = Opm::Connection::CTFKind::DeckValue;
@@ -18,6 +18,8 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <fstream>
+
 #include <boost/test/unit_test.hpp>
 
 #include <opm/json/JsonObject.hpp>
@@ -34,6 +36,8 @@
 #include "src/opm/parser/eclipse/Parser/raw/RawKeyword.hpp"
 #include "src/opm/parser/eclipse/Parser/raw/RawRecord.hpp"
 
+#include <tests/WorkArea.cpp>
+
 using namespace Opm;
 
 namespace {
@@ -2309,3 +2313,172 @@ auto record = kw.getRecord(1);
 BOOST_CHECK_EQUAL( record.getItem(5).get<double>(0), 0.9 );
 BOOST_CHECK( !deck.hasKeyword("LANGMUIR") );
 }
+
+BOOST_AUTO_TEST_CASE(ParseThreads_DeckEqualsSerial) {
+    const auto deck_string = std::string { R"(RUNSPEC
+FIELD
+DIMENS
+  2 2 2 /
+GRID
+DX
+  8*100 /
+PORO
+  4*0.25 4*0.30 /
+EQUALS
+  PERMX 100 /
+/
+PERMX
+  1 2 3 4 5 6 7 8 /
+NTG
+  8*1 /
+ACTNUM
+  0 7*1 /
+)"};
+
+    Parser serial_parser;
+    Parser threaded_parser;
+    threaded_parser.setParseThreads( 4 );
+    BOOST_CHECK_EQUAL( threaded_parser.parseThreads(), 4 );
+
+    const auto serial = serial_parser.parseString( deck_string );
+    const auto threaded = threaded_parser.parseString( deck_string );
+
+    BOOST_REQUIRE_EQUAL( serial.size(), threaded.size() );
+    for (std::size_t index = 0; index < serial.size(); index++)
+        BOOST_CHECK( serial.getKeyword(index).equal( threaded.getKeyword(index) ) );
+
+    const auto& dx = threaded.getKeyword("DX");
+    BOOST_CHECK_CLOSE( dx.getSIDoubleData()[0], 100 * 0.3048, 1e-8 );
+    BOOST_CHECK_EQUAL( threaded.getKeyword("ACTNUM").getIntData()[0], 0 );
+
+    const auto bad_string = std::string { R"(GRID
+PORO
+  4*0.25 4*X /
+)"};
+    BOOST_CHECK_THROW( threaded_parser.parseString( bad_string ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE(DataKeyword_BulkScan) {
+    const auto deck_string = std::string { R"(GRID
+PORO
+  2*0.25 0.30, 1* 3.5D-1
+  1.0E-1 /
+ACTNUM
+  3*1 0 /
+)"};
+
+    Parser parser;
+    const auto deck = parser.parseString( deck_string );
+
+    const auto& poro = deck.getKeyword("PORO").getRecord(0).getItem(0);
+    BOOST_REQUIRE_EQUAL( poro.data_size(), 6 );
+    BOOST_CHECK_EQUAL( poro.get<double>(0), 0.25 );
+    BOOST_CHECK_EQUAL( poro.get<double>(1), 0.25 );
+    BOOST_CHECK_EQUAL( poro.get<double>(2), 0.30 );
+    BOOST_CHECK( poro.defaultApplied(3) );
+    BOOST_CHECK_EQUAL( poro.get<double>(4), 0.35 );
+    BOOST_CHECK_EQUAL( poro.get<double>(5), 0.1 );
+
+    const auto& actnum = deck.getKeyword("ACTNUM").getIntData();
+    BOOST_CHECK( actnum == std::vector<int>({1, 1, 1, 0}) );
+
+    BOOST_CHECK_THROW( parser.parseString( "GRID\nPORO\n 0*0.25 /\n" ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE(ReparseChangedFiles) {
+    WorkArea work_area;
+    const auto write_file = [](const std::string& fname, const std::string& content) {
+        std::ofstream stream(fname);
+        stream << content;
+    };
+
+    write_file("CASE.DATA", R"(
+RUNSPEC
+FIELD
+DIMENS
+ 2 2 1 /
+EQLDIMS
+ 2 /
+GRID
+INCLUDE
+ 'grid.inc' /
+SOLUTION
+INCLUDE
+ 'equil.inc' /
+SCHEDULE
+WELSPECS
+ 'W1' 'G1' 1 1 1* 'OIL' /
+/
+)");
+    write_file("grid.inc", "DX\n 4*100 /\nPORO\n 4*0.25 /\n");
+    write_file("equil.inc", "EQUIL\n 1000 200 /\n 2000 300 /\n");
+
+    Parser parser;
+    ParseContext parseContext;
+    ErrorGuard errors;
+    const auto deck = parser.parseFile("CASE.DATA", parseContext, errors);
+
+    const auto check_reparse = [&](const Deck& previous, const std::vector<std::string>& changed) {
+        const auto reparsed = parser.reparseFiles(previous, changed, parseContext, errors);
+        const auto full = parser.parseFile("CASE.DATA", parseContext, errors);
+        BOOST_REQUIRE_EQUAL( reparsed.size(), full.size() );
+        for (std::size_t index = 0; index < full.size(); index++) {
+            BOOST_CHECK( reparsed.getKeyword(index).equal( full.getKeyword(index) ) );
+            BOOST_CHECK_EQUAL( reparsed.getKeyword(index).location().filename, full.getKeyword(index).location().filename );
+        }
+        return reparsed;
+    };
+
+    write_file("equil.inc", "EQUIL\n 1500 250 /\n 2500 350 /\n");
+    const auto deck1 = check_reparse(deck, {"equil.inc"});
+    BOOST_CHECK_EQUAL( deck1.getKeyword("EQUIL").size(), 2U );
+    BOOST_CHECK_CLOSE( deck1.getKeyword("EQUIL").getRecord(1).getItem(0).getSIDouble(0), 2500 * 0.3048, 1e-8 );
+
+    write_file("grid.inc", "DX\n 4*200 /\nPERMX\n 4*10 /\nPORO\n 4*0.30 /\n");
+    const auto deck2 = check_reparse(deck1, {"grid.inc"});
+    BOOST_CHECK( deck2.hasKeyword("PERMX") );
+    BOOST_CHECK_CLOSE( deck2.getKeyword("DX").getSIDoubleData()[0], 200 * 0.3048, 1e-8 );
+    BOOST_CHECK( deck2.getInputFiles() == deck.getInputFiles() );
+
+    // Only the listed file is parsed again; the unlisted change to
+    // grid.inc is only seen by a full parse.
+    write_file("grid.inc", "DX\n 4*300 /\nPORO\n 4*0.30 /\n");
+    write_file("equil.inc", "EQUIL\n 1600 260 /\n 2600 360 /\n");
+    {
+        const auto incremental = parser.reparseFiles(deck2, {"equil.inc"}, parseContext, errors);
+        BOOST_CHECK_CLOSE( incremental.getKeyword("DX").getSIDoubleData()[0], 200 * 0.3048, 1e-8 );
+        BOOST_CHECK( incremental.hasKeyword("PERMX") );
+        BOOST_CHECK_CLOSE( incremental.getKeyword("EQUIL").getRecord(1).getItem(0).getSIDouble(0), 2600 * 0.3048, 1e-8 );
+    }
+    write_file("grid.inc", "DX\n 4*200 /\nPERMX\n 4*10 /\nPORO\n 4*0.30 /\n");
+
+    // Changing a sizing keyword or the data file requires a full parse.
+    write_file("grid.inc", "DX\n 4*200 /\nPORO\n 4*0.30 /\nEQLDIMS\n 1 /\n");
+    write_file("equil.inc", "EQUIL\n 1500 250 /\n");
+    check_reparse(deck2, {"grid.inc", "equil.inc"});
+    check_reparse(deck2, {"CASE.DATA"});
+
+    // A file included twice back to back forms one block of keywords in
+    // the deck, but must be parsed again as two inclusions.
+    write_file("REPEAT.DATA", R"(
+RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+INCLUDE
+ 'poro.inc' /
+INCLUDE
+ 'poro.inc' /
+)");
+    write_file("poro.inc", "PORO\n 4*0.25 /\n");
+    const auto repeat_deck = parser.parseFile("REPEAT.DATA", parseContext, errors);
+    BOOST_CHECK_EQUAL( repeat_deck.count("PORO"), 2U );
+
+    write_file("poro.inc", "PORO\n 4*0.30 /\n");
+    const auto repeat_reparsed = parser.reparseFiles(repeat_deck, {"poro.inc"}, parseContext, errors);
+    BOOST_CHECK_EQUAL( repeat_reparsed.count("PORO"), 2U );
+    for (const auto* poro : repeat_reparsed.getKeywordList("PORO"))
+        BOOST_CHECK_CLOSE( poro->getSIDoubleData()[0], 0.30, 1e-8 );
+
+    BOOST_CHECK_THROW( parser.reparseFiles(parser.parseString("RUNSPEC\n"), {"grid.inc"}, parseContext, errors), std::invalid_argument );
+}
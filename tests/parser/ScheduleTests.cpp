@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
 #include <stdexcept>
 #include <iostream>
 #include <boost/filesystem.hpp>
@@ -654,6 +655,28 @@ BOOST_AUTO_TEST_CASE(WellsIterator_HasWells_WellsReturned) {
     BOOST_CHECK_EQUAL(3U, wells_t3.size());
 }
 
+BOOST_AUTO_TEST_CASE(WellPtrs_ReferToScheduleWells) {
+    EclipseGrid grid(10,10,10);
+    auto deck = createDeckWithWells();
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    FieldPropsManager fp( deck , grid, table);
+    Runspec runspec (deck);
+    Schedule schedule(deck , grid , fp, eclipseProperties, runspec);
+
+    BOOST_CHECK_EQUAL(1U, schedule.getWellPtrs(0).size());
+    BOOST_CHECK_THROW(schedule.getWellPtrs(100), std::invalid_argument);
+
+    const auto wells_t3 = schedule.getWellPtrs(3);
+    BOOST_CHECK_EQUAL(3U, wells_t3.size());
+    for (const auto* well : wells_t3)
+        BOOST_CHECK_EQUAL(well, &schedule.getWell(well->name(), 3));
+
+    const auto field_wells = schedule.getChildWellPtrs("FIELD", 3);
+    BOOST_CHECK_EQUAL(field_wells.size(), schedule.getChildWells2("FIELD", 3).size());
+    BOOST_CHECK_THROW(schedule.getChildWellPtrs("NO_SUCH_GROUP", 3), std::invalid_argument);
+}
+
 
 
 BOOST_AUTO_TEST_CASE(ReturnNumWellsTimestep) {
@@ -2272,6 +2295,174 @@ BOOST_AUTO_TEST_CASE( COMPDAT_multiple_records_same_completion ) {
 }
 
 
+namespace {
+
+/*
+  A synthetic SCHEDULE section with num_wells wells and num_steps report
+  steps. Every report step opens one new layer in each well with COMPDAT
+  records interleaved between the wells and a final 'W*' record, and then
+  lumps and scales the connections with COMPLUMP and WPIMULT; every other
+  report step also has a second COMPDAT keyword.
+*/
+std::string many_wells_deck(std::size_t num_wells, std::size_t num_steps, std::size_t nx, std::size_t ny) {
+    std::string input = R"(
+        START             -- 0
+        19 JUN 2007 /
+        GRID
+        PERMX
+          )" + std::to_string(nx * ny * num_steps) + R"(*0.10/
+        COPY
+          PERMX PERMY /
+          PERMX PERMZ /
+        /
+        SCHEDULE
+        WELSPECS
+)";
+    for (std::size_t w = 0; w < num_wells; w++)
+        input += "  'W" + std::to_string(w) + "' 'G1' " + std::to_string(w % nx + 1) + " " + std::to_string(w / nx + 1) + " 2873.94 'OIL' /\n";
+    input += "/\n";
+
+    for (std::size_t step = 1; step <= num_steps; step++) {
+        input += "TSTEP\n  1 /\nCOMPDAT\n";
+        for (std::size_t w = 0; w < num_wells; w++)
+            input += "  'W" + std::to_string(w) + "' 0 0 " + std::to_string(step) + " " + std::to_string(step) + " 'OPEN' 1* /\n";
+        input += "  'W*' 0 0 1 1 'SHUT' 1* /\n/\n";
+        input += "COMPLUMP\n  'W*' 0 0 1 " + std::to_string(step) + " " + std::to_string(step) + " /\n/\n";
+        input += "WPIMULT\n  'W1*' 2.0 /\n/\n";
+        if (step % 2 == 0)
+            input += "COMPDAT\n  'W0' 0 0 " + std::to_string(step) + " " + std::to_string(step) + " 'SHUT' 1* /\n/\n";
+    }
+    return input;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE( COMPDAT_many_wells_many_steps ) {
+    const std::size_t num_wells = 40;
+    const std::size_t num_steps = 10;
+    auto deck = Parser().parseString(many_wells_deck(num_wells, num_steps, 10, 10));
+    EclipseGrid grid(10,10,10);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    FieldPropsManager fp( deck , grid, table);
+    Runspec runspec (deck);
+    Schedule schedule( deck, grid, fp, eclipseProperties,runspec);
+
+    Schedule::setThreads(4);
+    Schedule threaded_schedule( deck, grid, fp, eclipseProperties,runspec);
+    Schedule::setThreads(1);
+    BOOST_CHECK( schedule.getEvents() == threaded_schedule.getEvents() );
+    BOOST_CHECK( schedule.getWellGroupEvents() == threaded_schedule.getWellGroupEvents() );
+
+    for (std::size_t step = 1; step <= num_steps; step++) {
+        BOOST_CHECK( schedule.getEvents().hasEvent(ScheduleEvents::COMPLETION_CHANGE, step) );
+        BOOST_CHECK( threaded_schedule.getEvents().hasEvent(ScheduleEvents::COMPLETION_CHANGE, step) );
+        for (std::size_t w = 0; w < num_wells; w++) {
+            const auto wname = "W" + std::to_string(w);
+            const auto& cs = threaded_schedule.getWell( wname, step ).getConnections();
+            BOOST_CHECK( cs == schedule.getWell( wname, step ).getConnections() );
+            BOOST_CHECK_EQUAL( step, cs.size() );
+            for (std::size_t k = 0; k < step; k++) {
+                const auto& conn = cs.getFromIJK( w % 10, w / 10, k );
+                const bool shut = (k == 0) || (w == 0 && (k + 1) % 2 == 0);
+                if (w != 0)
+                    BOOST_CHECK_EQUAL( static_cast<int>(step), conn.complnum() );
+                BOOST_CHECK( conn.state() == (shut ? Connection::State::SHUT : Connection::State::OPEN) );
+            }
+        }
+    }
+}
+
+
+/*
+  Times the construction of the Schedule for a larger version of the deck
+  above, serially and with four threads. The timings are reported with
+  --log_level=message.
+*/
+BOOST_AUTO_TEST_CASE( COMPDAT_many_wells_many_steps_benchmark ) {
+    const std::size_t num_wells = 200;
+    const std::size_t num_steps = 40;
+    auto deck = Parser().parseString(many_wells_deck(num_wells, num_steps, 20, 10));
+    EclipseGrid grid(20,10,num_steps);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    FieldPropsManager fp( deck , grid, table);
+    Runspec runspec (deck);
+
+    auto timed_schedule = [&](int num_threads, double& seconds) {
+        Schedule::setThreads(num_threads);
+        const auto start = std::chrono::steady_clock::now();
+        Schedule schedule( deck, grid, fp, eclipseProperties,runspec);
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Schedule::setThreads(1);
+        return schedule;
+    };
+
+    double serial_seconds, threaded_seconds;
+    const auto schedule = timed_schedule(1, serial_seconds);
+    const auto threaded_schedule = timed_schedule(4, threaded_seconds);
+    BOOST_CHECK( schedule.getEvents() == threaded_schedule.getEvents() );
+    BOOST_CHECK( schedule.getWellGroupEvents() == threaded_schedule.getWellGroupEvents() );
+    for (const auto& wname : schedule.wellNames())
+        BOOST_CHECK( schedule.getWell(wname, num_steps).getConnections() == threaded_schedule.getWell(wname, num_steps).getConnections() );
+    BOOST_TEST_MESSAGE("Schedule with " << num_wells << " wells and " << num_steps << " report steps: "
+                       << serial_seconds << " s serial, " << threaded_seconds << " s with 4 threads");
+}
+
+
+BOOST_AUTO_TEST_CASE( COMPDAT_pattern_field_units ) {
+    std::string input = R"(
+        START             -- 0
+        19 JUN 2007 /
+        FIELD
+        GRID
+        PERMX
+          1000*0.10/
+        COPY
+          PERMX PERMY /
+          PERMX PERMZ /
+        /
+        SCHEDULE
+        WELSPECS
+          'W1' 'G1' 1 1 2873.94 'OIL' /
+          'W2' 'G1' 2 1 2873.94 'OIL' /
+          'W3' 'G1' 3 1 2873.94 'OIL' /
+          'W4' 'G1' 4 1 2873.94 'OIL' /
+          'W5' 'G1' 5 1 2873.94 'OIL' /
+          'W6' 'G1' 6 1 2873.94 'OIL' /
+        /
+        COMPDAT
+          'W*' 0 0 1 2 'OPEN' 1* 10.0 0.5 1000.0 /
+        /
+)";
+
+    Schedule::setThreads(4);
+    auto deck = Parser().parseString(input);
+    EclipseGrid grid(10,10,10);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    FieldPropsManager fp( deck , grid, table);
+    Runspec runspec (deck);
+    Schedule schedule( deck, grid, fp, eclipseProperties,runspec);
+    Schedule::setThreads(1);
+
+    // Every well sees the record converted to SI exactly once
+    const auto& field = deck.getActiveUnitSystem();
+    const double rw = 0.5 * field.to_si(UnitSystem::measure::length, 0.5);
+    const double CF = field.to_si(UnitSystem::measure::transmissibility, 10.0);
+    const double Kh = field.to_si(UnitSystem::measure::effective_Kh, 1000.0);
+    for (const auto& wname : schedule.wellNames(0)) {
+        const auto& connections = schedule.getWell(wname, 0).getConnections();
+        BOOST_REQUIRE_EQUAL( connections.size(), 2U );
+        for (const auto& conn : connections) {
+            BOOST_CHECK_CLOSE( conn.rw(), rw, 1e-8 );
+            BOOST_CHECK_CLOSE( conn.CF(), CF, 1e-8 );
+            BOOST_CHECK_CLOSE( conn.Kh(), Kh, 1e-8 );
+        }
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE( complump_less_than_1 ) {
     std::string input = R"(
             START             -- 0
@@ -3026,6 +3217,85 @@ BOOST_AUTO_TEST_CASE(FilterCompletions2) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(WellConnectionsShared) {
+    std::string input = R"(
+        START             -- 0
+        19 JUN 2007 /
+        GRID
+        PERMX
+          1000*0.10/
+        COPY
+          PERMX PERMY /
+          PERMX PERMZ /
+        /
+        SCHEDULE
+        WELSPECS
+            'W1' 'G1'  3 3 2873.94 'OIL' /
+        /
+        COMPDAT
+            'W1' 0 0 1 3 'OPEN' 1* /
+        /
+        DATES             -- 1
+            10  OKT 2008 /
+        /
+        WCONPROD
+            'W1' 'OPEN' 'ORAT' 1000 /
+        /
+        DATES             -- 2
+            10  NOV 2008 /
+        /
+        WELOPEN
+            'W1' 'OPEN' 0 0 1 /
+        /
+        DATES             -- 3
+            10  DEC 2008 /
+        /
+        WPIMULT
+            'W1' 2.0 /
+        /
+    )";
+
+    auto deck = Parser().parseString(input);
+    EclipseGrid grid(10,10,10);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    FieldPropsManager fp( deck , grid, table);
+    Runspec runspec (deck);
+    Schedule schedule( deck, grid, fp, eclipseProperties,runspec);
+
+    const auto connections = [&schedule](std::size_t step) {
+        return &schedule.getWell("W1", step).getConnections();
+    };
+
+    // Neither the rate change nor opening an already open connection copies
+    // the connection set.
+    BOOST_CHECK( connections(0) == connections(1) );
+    BOOST_CHECK( connections(0) == connections(2) );
+    BOOST_CHECK( connections(0) != connections(3) );
+
+    // Deactivate the cell of the first connection; the active cells are
+    // taken from a grid with the reduced ACTNUM.
+    std::vector<int> actnum(1000,1);
+    actnum[grid.getGlobalIndex(2,2,0)] = 0;
+    EclipseGrid active_grid(10,10,10);
+    active_grid.resetACTNUM(actnum);
+    BOOST_REQUIRE_EQUAL( active_grid.getNumActive(), 999U );
+    std::vector<int> globalCell(active_grid.getNumActive());
+    for (std::size_t i = 0; i < active_grid.getNumActive(); ++i)
+        globalCell[i] = active_grid.getGlobalIndex(i);
+    ActiveGridCells active(active_grid.getNXYZ(), globalCell.data(), active_grid.getNumActive());
+    BOOST_CHECK( !active.cellActive(2,2,0) );
+    BOOST_CHECK( active.cellActive(2,2,1) );
+    schedule.filterConnections(active);
+
+    BOOST_CHECK( connections(0) == connections(1) );
+    BOOST_CHECK( connections(0) == connections(2) );
+    BOOST_CHECK_EQUAL( connections(0)->size(), 2U );
+    BOOST_CHECK_EQUAL( connections(3)->size(), 2U );
+    BOOST_CHECK_EQUAL( connections(3)->inputSize(), 3U );
+}
+
+
 
 
 
@@ -3439,6 +3709,18 @@ BOOST_AUTO_TEST_CASE(WellNames) {
 
     auto abs_all = schedule.wellNames();
     BOOST_CHECK_EQUAL(abs_all.size(), 9);
+
+    // The wells matching a pattern are returned in the order they were defined.
+    BOOST_CHECK( schedule.wellNames("*", 2) == schedule.wellNames(std::size_t{2}) );
+    BOOST_CHECK( schedule.wellNames("W*", 2) == std::vector<std::string>({"W1", "W2", "W3"}) );
+
+    auto qnames = schedule.wellNames("?1*", 2);
+    BOOST_CHECK_EQUAL(qnames.size(), 2);
+    BOOST_CHECK( has(qnames, "W1"));
+    BOOST_CHECK( has(qnames, "I1"));
+
+    auto bnames = schedule.wellNames("[WI]2*", 0);
+    BOOST_CHECK( bnames == std::vector<std::string>({"W2"}) );
 }
 
 
@@ -125,3 +125,24 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+BOOST_AUTO_TEST_CASE( readFastValueToken_tests ) {
+    int i = 0;
+    BOOST_CHECK( Opm::readFastValueToken<int>( std::string( "-3" ), i ) );
+    BOOST_CHECK_EQUAL( -3, i );
+    BOOST_CHECK( Opm::readFastValueToken<int>( std::string( "+123456789" ), i ) );
+    BOOST_CHECK_EQUAL( 123456789, i );
+    BOOST_CHECK( !Opm::readFastValueToken<int>( std::string( "3.3" ), i ) );
+    BOOST_CHECK( !Opm::readFastValueToken<int>( std::string( "1234567890" ), i ) );
+    BOOST_CHECK( !Opm::readFastValueToken<int>( std::string( "2*3" ), i ) );
+
+    double d = 0;
+    for (const auto* token : { "0", "-0.0", ".5", "5.", "3.3", "3.3D0", "1.5e-3", "-2.25E+02",
+                               "0.000123456789012345", "2670.15", "1e22", "123456789012345" }) {
+        BOOST_CHECK( Opm::readFastValueToken<double>( std::string( token ), d ) );
+        BOOST_CHECK_EQUAL( d, Opm::readValueToken<double>( std::string( token ) ) );
+    }
+
+    for (const auto* token : { ".", "1.0.0", "1g0", "1.23h", "1e", "3*", "1234567890123456", "1e300", "'1'" })
+        BOOST_CHECK( !Opm::readFastValueToken<double>( std::string( token ), d ) );
+}
@@ -51,9 +51,15 @@ inline EclipseState makeState(const std::string& fileName) {
 
 BOOST_AUTO_TEST_CASE( PERMX ) {
     EclipseState state = makeState( prefix() + "BOX/BOXTEST1" );
+#ifdef ENABLE_3DPROPS_TESTING
+    const auto& permx = state.fieldProps().get_global<double>( "PERMX" );
+    const auto& permy = state.fieldProps().get_global<double>( "PERMY" );
+    const auto& permz = state.fieldProps().get_global<double>( "PERMZ" );
+#else
     const auto& permx = state.get3DProperties().getDoubleGridProperty( "PERMX" ).getData();
     const auto& permy = state.get3DProperties().getDoubleGridProperty( "PERMY" ).getData();
     const auto& permz = state.get3DProperties().getDoubleGridProperty( "PERMZ" ).getData();
+#endif
     size_t i, j, k;
     const EclipseGrid& grid = state.getInputGrid();
 
@@ -74,7 +80,11 @@ BOOST_AUTO_TEST_CASE( PERMX ) {
 
 BOOST_AUTO_TEST_CASE( PARSE_BOX_OK ) {
     EclipseState state = makeState( prefix() + "BOX/BOXTEST1" );
+#ifdef ENABLE_3DPROPS_TESTING
+    const auto& satnum = state.fieldProps().get_global<int>( "SATNUM" );
+#else
     const auto& satnum = state.get3DProperties().getIntGridProperty( "SATNUM" ).getData();
+#endif
     {
         size_t i, j, k;
         const EclipseGrid& grid = state.getInputGrid();
@@ -96,8 +106,13 @@ BOOST_AUTO_TEST_CASE( PARSE_BOX_OK ) {
 
 BOOST_AUTO_TEST_CASE( PARSE_MULTIPLY_COPY ) {
     EclipseState state = makeState( prefix() + "BOX/BOXTEST1" );
+#ifdef ENABLE_3DPROPS_TESTING
+    const auto& satnum = state.fieldProps().get_global<int>( "SATNUM" );
+    const auto& fipnum = state.fieldProps().get_global<int>( "FIPNUM" );
+#else
     const auto& satnum = state.get3DProperties().getIntGridProperty( "SATNUM" ).getData();
     const auto& fipnum = state.get3DProperties().getIntGridProperty( "FIPNUM" ).getData();
+#endif
     size_t i, j, k;
     const EclipseGrid& grid = state.getInputGrid();
 
@@ -121,9 +136,15 @@ BOOST_AUTO_TEST_CASE( PARSE_MULTIPLY_COPY ) {
 
 BOOST_AUTO_TEST_CASE( EQUALS ) {
     EclipseState state = makeState( prefix() + "BOX/BOXTEST1" );
+#ifdef ENABLE_3DPROPS_TESTING
+    const auto& pvtnum = state.fieldProps().get_global<int>( "PVTNUM" );
+    const auto& eqlnum = state.fieldProps().get_global<int>( "EQLNUM" );
+    const auto& poro = state.fieldProps().get_global<double>( "PORO" );
+#else
     const auto& pvtnum = state.get3DProperties().getIntGridProperty( "PVTNUM" ).getData();
     const auto& eqlnum = state.get3DProperties().getIntGridProperty( "EQLNUM" ).getData();
     const auto& poro = state.get3DProperties().getDoubleGridProperty( "PORO" ).getData();
+#endif
     size_t i, j, k;
     const EclipseGrid& grid = state.getInputGrid();
 
@@ -31,6 +31,7 @@
 #include <iostream>
 #include <math.h>
 #include <stdio.h>
+#include <thread>
 #include <tuple>
 
 using Opm::EclIO::ESmry;
@@ -354,3 +355,72 @@ BOOST_AUTO_TEST_CASE(TestESmry_4) {
 
 
 
+
+BOOST_AUTO_TEST_CASE(TestESmry_BatchGet) {
+
+    std::vector <float> time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref, fgor_ref, bpr_111_ref, bpr_10103_ref;
+
+    getRefSmryVect(time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref,fgor_ref, bpr_111_ref, bpr_10103_ref);
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+
+    auto vectors = smry1.get(std::vector<std::string>{"TIME", "WBHP:PROD", "BPR:1,1,1"});
+
+    BOOST_CHECK_EQUAL(vectors.size(), 3);
+    BOOST_CHECK_EQUAL(vectors[0]==time_ref, true);
+
+    for (unsigned int i=0;i< vectors[1].size();i++){
+        BOOST_REQUIRE_CLOSE (vectors[1][i], wbhp_prod_ref[i], 0.01);
+    }
+
+    for (unsigned int i=0;i< vectors[2].size();i++){
+        BOOST_REQUIRE_CLOSE (vectors[2][i], bpr_111_ref[i], 0.01);
+    }
+
+    BOOST_CHECK_THROW(smry1.get(std::vector<std::string>{"TIME", "XXXX"}), std::invalid_argument);
+
+    // loading all vectors gives same result as vectors loaded on demand
+
+    ESmry smry2("SPE1CASE1.SMSPEC");
+    smry2.loadData();
+
+    for (const auto& key : smry1.keywordList()) {
+        BOOST_CHECK_EQUAL(smry1.get(key)==smry2.get(key), true);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestESmry_ConcurrentGet) {
+
+    ESmry reference("SPE1CASE1.SMSPEC");
+    reference.loadData();
+
+    const auto& keys = reference.keywordList();
+
+    // several threads loading the same vectors on demand, in different order
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+
+    const int nThreads = 4;
+    std::vector<std::vector<std::vector<float>>> results(nThreads);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < nThreads; t++) {
+        threads.emplace_back([&smry1, &keys, &results, t]()
+        {
+            auto& res = results[t];
+            res.resize(keys.size());
+            for (size_t n = 0; n < keys.size(); n++) {
+                const size_t i = (t % 2 == 0) ? n : keys.size() - 1 - n;
+                res[i] = smry1.get(keys[i]);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int t = 0; t < nThreads; t++) {
+        for (size_t i = 0; i < keys.size(); i++)
+            BOOST_CHECK_EQUAL(results[t][i]==reference.get(keys[i]), true);
+    }
+}
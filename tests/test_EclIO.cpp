@@ -32,6 +32,7 @@
 #include "WorkArea.cpp"
 
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
 #include <boost/test/unit_test.hpp>
@@ -136,6 +137,143 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY) {
     BOOST_CHECK_EQUAL(vect5b.size(), 312);
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_BINARY_MemoryMapped) {
+
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, false, true);
+
+    BOOST_CHECK(!file1.memoryMapped());
+#if defined(__unix__) || defined(__APPLE__)
+    BOOST_CHECK(file2.memoryMapped());
+#endif
+
+    BOOST_CHECK_EQUAL(file1.size(), file2.size());
+    BOOST_CHECK(file1.arrayNames() == file2.arrayNames());
+
+    BOOST_CHECK_THROW(file2.get<int>("PORV") , std::runtime_error );
+
+    BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+    BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+    BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+    BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+
+    // memory mapping is not used for formatted files
+
+    EclFile file3("ECLFILE.FINIT", false, true);
+    BOOST_CHECK(!file3.memoryMapped());
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_BINARY_LargeArrays) {
+
+    // arrays spanning many Fortran records, read back both through the
+    // stream reader and through the memory mapped reader
+
+    std::string testFile="LARGE.DAT";
+
+    std::vector<int> inte(100003);
+    std::vector<double> doub(70001);
+    std::vector<bool> logi(100003);
+    std::vector<std::string> chars(7001);
+
+    for (size_t i = 0; i < inte.size(); i++) {
+        inte[i] = static_cast<int>(i) - 500;
+        logi[i] = (i % 3) == 0;
+    }
+
+    for (size_t i = 0; i < doub.size(); i++)
+        doub[i] = 0.25 * i;
+
+    for (size_t i = 0; i < chars.size(); i++)
+        chars[i] = "C" + std::to_string(i % 1000);
+
+    {
+        EclOutput eclTest(testFile, false);
+
+        eclTest.write("INTE",inte);
+        eclTest.write("DOUB",doub);
+        eclTest.write("LOGI",logi);
+        eclTest.write("CHARS",chars);
+    }
+
+    for (bool memoryMap : {false, true}) {
+        EclFile file1(testFile, false, memoryMap);
+
+        BOOST_CHECK(file1.get<int>("INTE") == inte);
+        BOOST_CHECK(file1.get<double>("DOUB") == doub);
+        BOOST_CHECK(file1.get<bool>("LOGI") == logi);
+        BOOST_CHECK(file1.get<std::string>("CHARS") == chars);
+    }
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestEclFile_BINARY_CorruptRecord) {
+
+    // the data record of INTE claims more elements than the array header,
+    // which must be rejected before the record is copied into the array
+
+    std::string testFile="CORRUPT.DAT";
+
+    {
+        EclOutput eclTest(testFile, false);
+        eclTest.write("INTE", std::vector<int>(10, 1));
+        eclTest.write("DOUB", std::vector<double>(10, 1.0));
+    }
+
+    {
+        // leading marker of the data record, stored big endian directly
+        // after the 24 bytes of the header record; 60 bytes = 15 elements
+        std::fstream fileH(testFile, std::ios::in | std::ios::out | std::ios::binary);
+        const char marker[4] = {0, 0, 0, 60};
+        fileH.seekp(24);
+        fileH.write(marker, 4);
+    }
+
+    for (bool memoryMap : {false, true}) {
+        EclFile file1(testFile, false, memoryMap);
+        BOOST_CHECK_THROW(file1.get<int>("INTE"), std::runtime_error);
+        BOOST_CHECK(file1.get<double>("DOUB") == std::vector<double>(10, 1.0));
+    }
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestFlipEndianBlock) {
+
+    std::vector<int> inte(2503);
+    std::vector<float> real(2503);
+    std::vector<double> doub(2503);
+
+    for (std::size_t i = 0; i < inte.size(); i++) {
+        inte[i] = static_cast<int>(i*7919) - 1000;
+        real[i] = 0.25f * i - 17.0f;
+        doub[i] = 1.0e-3 * i - 3.5;
+    }
+
+    auto inte2 = inte;
+    auto real2 = real;
+    auto doub2 = doub;
+
+    flipEndianInt(inte2.data(), inte2.size());
+    flipEndianFloat(real2.data(), real2.size());
+    flipEndianDouble(doub2.data(), doub2.size());
+
+    for (std::size_t i = 0; i < inte.size(); i++) {
+        BOOST_CHECK_EQUAL(inte2[i], flipEndianInt(inte[i]));
+        BOOST_CHECK_EQUAL(flipEndianFloat(real2[i]), real[i]);
+        BOOST_CHECK_EQUAL(flipEndianDouble(doub2[i]), doub[i]);
+    }
+
+    BOOST_CHECK_EQUAL(flipEndianInt(0x01020304), 0x04030201);
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 
     std::string testFile1="ECLFILE.INIT";
@@ -357,3 +495,35 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR) {
 
 
 }
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_Generator) {
+    WorkArea wa;
+
+    // Large enough to span several record blocks in both binary and
+    // formatted files.
+    std::vector<double> values(2503);
+    for (std::size_t i = 0; i < values.size(); i++)
+        values[i] = 0.25 * i - 17.0;
+
+    const std::vector<float> values_f(values.begin(), values.end());
+
+    for (const bool formatted : {false, true}) {
+        {
+            EclOutput eclTest("VECTOR.DAT", formatted);
+            eclTest.write("VALUES", values_f);
+            eclTest.write("INDEX", std::vector<int>{1, 2, 3});
+        }
+
+        {
+            EclOutput eclTest("STREAM.DAT", formatted);
+            eclTest.write<float>("VALUES", values.size(), [&values](std::size_t i) {
+                return static_cast<float>(values[i]);
+            });
+            eclTest.write<int>("INDEX", 3, [](std::size_t i) {
+                return static_cast<int>(i + 1);
+            });
+        }
+
+        BOOST_CHECK_EQUAL(compare_files("VECTOR.DAT", "STREAM.DAT"), true);
+    }
+}
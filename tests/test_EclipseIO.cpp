@@ -276,7 +276,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         "'PROD' 'G' 3 3 1000 'OIL' /\n"
         "/\n";
 
-    auto write_and_check = [&]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&]( int first = 1, int last = 5, bool async = false, bool flushEachStep = true ) {
         auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         auto& eclGrid = es.getInputGrid();
@@ -286,6 +286,8 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        if (async)
+            eclWriter.enableAsyncOutput(flushEachStep ? 2 : 4);
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -326,7 +328,15 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
                                      first_step - start_time,
                                      restart_value);
 
-            checkRestartFile( i );
+            if (flushEachStep) {
+                eclWriter.flushOutput();
+                checkRestartFile( i );
+            }
+        }
+
+        if (!flushEachStep) {
+            eclWriter.flushOutput();
+            checkRestartFile( last - 1 );
         }
 
         checkInitFile( deck , eGridProps);
@@ -370,6 +380,12 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
      */
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
 
+    /* output written from the background thread must be identical */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true ) );
+
+    /* several steps queued before flushing */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true, false ) );
+
     /* verify that adding steps from restart also increases file size */
     BOOST_CHECK( file_size < write_and_check( 3, 7 ) );
 
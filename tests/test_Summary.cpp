@@ -24,7 +24,9 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <cstddef>
+#include <cstdio>
 #include <exception>
+#include <fstream>
 #include <memory>
 #include <stdexcept>
 #include <unordered_map>
@@ -45,6 +47,8 @@
 
 #include <opm/parser/eclipse/Units/Units.hpp>
 
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 
 #include <tests/WorkArea.cpp>
@@ -1621,6 +1625,134 @@ BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     BOOST_CHECK_EQUAL(st.num_wells(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(Threaded_Evaluation)
+{
+    setup cfg("test_threaded_evaluation");
+
+    out::Summary serial( cfg.es, cfg.config, cfg.grid, cfg.schedule , cfg.name );
+    out::Summary threaded( cfg.es, cfg.config, cfg.grid, cfg.schedule , cfg.name );
+    threaded.set_eval_threads(4);
+
+    const auto start = std::chrono::system_clock::now();
+    SummaryState st_serial(start);
+    SummaryState st_threaded(start);
+
+    for (int step = 0; step < 3; ++step) {
+        serial.eval(st_serial, step, step*day, cfg.es, cfg.schedule, cfg.wells, {});
+        threaded.eval(st_threaded, step, step*day, cfg.es, cfg.schedule, cfg.wells, {});
+    }
+
+    BOOST_CHECK_EQUAL(st_serial.size(), st_threaded.size());
+    for (const auto& value_pair : st_serial)
+        BOOST_CHECK_EQUAL(value_pair.second, st_threaded.get(value_pair.first));
+}
+
+BOOST_AUTO_TEST_CASE(Columnar_Summary)
+{
+    setup cfg("test_columnar_summary");
+    cfg.es.getIOConfig().setColumnarSummary(true);
+
+    SummaryState st(std::chrono::system_clock::now());
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule , cfg.name );
+    writer.eval(st, 0, 0*day, cfg.es, cfg.schedule, cfg.wells, {});
+    writer.add_timestep( st, 0);
+    writer.write();
+
+    writer.eval(st, 1, 1*day, cfg.es, cfg.schedule, cfg.wells, {});
+    writer.add_timestep( st, 1);
+    writer.eval(st, 1, 2*day, cfg.es, cfg.schedule, cfg.wells, {});
+    writer.add_timestep( st, 1);
+    writer.write();
+
+    writer.eval(st, 2, 3*day, cfg.es, cfg.schedule, cfg.wells, {});
+    writer.add_timestep( st, 2);
+    writer.write();
+
+    const auto columnFile = cfg.name + ".UCSMRY";
+    BOOST_REQUIRE(std::ifstream(columnFile).good());
+
+    {
+        EclIO::EclFile csmry(columnFile);
+        const auto arrays = csmry.getList();
+
+        // One SEQHDR/MINISTEP/COLUMNS triplet per report step written.
+        BOOST_REQUIRE_EQUAL(arrays.size(), std::size_t{9});
+        BOOST_CHECK_EQUAL(std::get<0>(arrays[0]), "SEQHDR");
+        BOOST_CHECK_EQUAL(std::get<0>(arrays[3]), "SEQHDR");
+        BOOST_CHECK_EQUAL(std::get<0>(arrays[4]), "MINISTEP");
+        BOOST_CHECK_EQUAL(std::get<0>(arrays[5]), "COLUMNS");
+
+        const auto& ministeps = csmry.get<int>(4);
+        BOOST_CHECK_EQUAL(ministeps.size(), std::size_t{2});
+        BOOST_CHECK_EQUAL(ministeps[0], 1);
+        BOOST_CHECK_EQUAL(ministeps[1], 2);
+    }
+
+    const auto keys = std::vector<std::string> {
+        "TIME", "WOPR:W_1", "WWPR:W_2", "WOPT:W_1", "FOPR"
+    };
+
+    std::vector<std::vector<float>> columnar;
+    {
+        auto res = readsum( cfg.name );
+        for (const auto& key : keys)
+            columnar.push_back(res->get(key));
+    }
+
+    // A column file which does not hold the same time steps as the result
+    // file is ignored, even though it is newer.
+    {
+        std::vector<std::string> names;
+        std::vector<std::vector<int>> ints;
+        std::vector<std::vector<float>> floats;
+        {
+            EclIO::EclFile csmry(columnFile);
+            for (const auto& array : csmry.getList()) {
+                names.push_back(std::get<0>(array));
+                if (std::get<1>(array) == EclIO::INTE) {
+                    ints.push_back(csmry.get<int>(names.back()));
+                    floats.emplace_back();
+                } else {
+                    ints.emplace_back();
+                    floats.emplace_back(csmry.get<float>(names.back()).size(), -1.0f);
+                }
+            }
+        }
+
+        ints[names.size() - 2].back() += 10;
+
+        {
+            EclIO::EclOutput stale(columnFile, false);
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                if (names[i] == "COLUMNS")
+                    stale.write(names[i], floats[i]);
+                else
+                    stale.write(names[i], ints[i]);
+            }
+        }
+
+        auto res = readsum( cfg.name );
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            const auto& values = res->get(keys[i]);
+            BOOST_CHECK_EQUAL_COLLECTIONS(columnar[i].begin(), columnar[i].end(),
+                                          values.begin(), values.end());
+        }
+    }
+
+    std::remove(columnFile.c_str());
+
+    auto res = readsum( cfg.name );
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto& rowMajor = res->get(keys[i]);
+        BOOST_CHECK_EQUAL_COLLECTIONS(columnar[i].begin(), columnar[i].end(),
+                                      rowMajor.begin(), rowMajor.end());
+    }
+
+    BOOST_CHECK_EQUAL(columnar[0].size(), std::size_t{4});
+    BOOST_CHECK_CLOSE(columnar[0][3], 3.0f, 1.0e-5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ####################################################################
@@ -3185,6 +3317,59 @@ BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     BOOST_CHECK_EQUAL(st.get_elapsed(), 200);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Slots) {
+    SummaryState st(std::chrono::system_clock::now());
+
+    const auto fopr = st.slot("FOPR");
+    const auto fopt = st.slot("FOPT");
+    const auto wopt = st.well_slot("OP1", "WOPT");
+    const auto gopr = st.group_slot("G1", "GOPR");
+
+    BOOST_CHECK_EQUAL(st.slot("FOPR"), fopr);
+    BOOST_CHECK_EQUAL(st.well_slot("OP1", "WOPT"), wopt);
+    BOOST_CHECK(!st.has("FOPR"));
+    BOOST_CHECK(!st.has_slot(fopr));
+    BOOST_CHECK(!st.has_well_var("OP1", "WOPT"));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+
+    st.update_slot(fopr, 100);
+    st.update_slot(fopr, 100);
+    st.update_slot(fopt, 100);
+    st.update_slot(fopt, 100);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 100);
+    BOOST_CHECK_EQUAL(st.get("FOPT"), 200);
+    BOOST_CHECK_EQUAL(st.get_slot(fopt), 200);
+
+    st.update_slot(wopt, 50);
+    st.update_well_var("OP1", "WOPT", 50);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 100);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 100);
+    BOOST_CHECK_EQUAL(st.num_wells(), 1U);
+
+    st.update_group_var("G1", "GOPR", 10);
+    BOOST_CHECK_EQUAL(st.get_slot(gopr), 10);
+    BOOST_CHECK(st.has_group_var("G1", "GOPR"));
+
+    const auto layout = st.layout_id();
+    SummaryState st2 = st;
+    BOOST_CHECK(st2.layout_id() != layout);
+    BOOST_CHECK_EQUAL(st2.get("FOPT"), 200);
+
+    st2.deserialize(st.serialize());
+    BOOST_CHECK_EQUAL(st2.get_well_var("OP1", "WOPT"), 100);
+    BOOST_CHECK_EQUAL(st2.get("WOPT:OP1"), 100);
+    BOOST_CHECK_EQUAL(st2.size(), st.size());
+    BOOST_CHECK_EQUAL(st.layout_id(), layout);
+
+    std::size_t count = 0;
+    for (auto it = st.begin(); it != st.end(); ++it) {
+        BOOST_CHECK_EQUAL(it->second, st.get(it->first));
+        BOOST_CHECK_EQUAL((*it).first, it->first);
+        count += 1;
+    }
+    BOOST_CHECK_EQUAL(count, st.size());
+}
+
 namespace {
 bool equal(const SummaryState& st1 , const SummaryState& st2) {
     if (st1.size() != st2.size())
@@ -44,7 +44,11 @@ BOOST_AUTO_TEST_CASE(create) {
     EclipseState es(deck);
     const EclipseGrid& grid = es.getInputGrid();
     Schedule schedule( deck, es);
+#ifdef ENABLE_3DPROPS_TESTING
+    out::RegionCache rc(es.fieldProps().get<int>("FIPNUM") , grid, schedule);
+#else
     out::RegionCache rc(es.get3DProperties().getIntGridProperty("FIPNUM").compressedCopy(grid) , grid, schedule);
+#endif
 
     {
         const auto& empty = rc.connections( 4 );